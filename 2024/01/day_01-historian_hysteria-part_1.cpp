@@ -1,46 +1,62 @@
 #include <algorithm>
 #include <cassert>
-#include <cctype>
-#include <charconv>
-#include <cmath>
 #include <cstddef>
-#include <fstream>
+#include <cstdint>
 #include <iostream>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
-std::pair<std::vector<int>, std::vector<int>> getInput()
+#include <aoc/mapped_file.h>
+#include <aoc/radix_sort.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+
+typedef std::pair<std::vector<std::uint32_t>, std::vector<std::uint32_t>> Lists;
+
+Lists getInput()
 {
-    std::vector<std::string> lines;
-    for (std::ifstream input("day_01-historian_hysteria-input.txt");
-         std::getline(input, lines.emplace_back()); ) {
-    }
-    lines.pop_back();
-    std::vector<int> lhs(lines.size()), rhs(lines.size());
-    for (std::size_t i = 0; i < lines.size(); ++i) {
-        const char       *cursor  = lines[i].c_str(),
-                   *const lineEnd = cursor + lines[i].size();
-        const auto [ptr1, errc1] = std::from_chars(cursor, lineEnd, lhs[i]);
-        assert(errc1 == std::errc());
-        for (cursor = ptr1; isspace(*cursor); ++cursor)
+    const aoc::MappedFile file("day_01-historian_hysteria-input.txt");
+    Lists lists;
+    auto& [lhs, rhs] = lists;
+    lhs.reserve(file.view().size() / 8);
+    rhs.reserve(file.view().size() / 8);
+    for (aoc::Scanner scanner(file.view()); !scanner.atEnd(); ) {
+        std::uint32_t left = 0, right = 0;
+        bool parsed = scanner.readInt(left);
+        while (scanner.consume(' '))
             continue;
-        
-        const auto [_, errc2] = std::from_chars(cursor, lineEnd, rhs[i]);
-        assert(errc2 == std::errc());
+        parsed = parsed && scanner.readInt(right);
+        if (parsed) {
+            lhs.push_back(left);
+            rhs.push_back(right);
+        }
+
+        // Skip whatever is left of the line ('\r' of CRLF input, or all of
+        // a line that failed to parse) so that the loop always advances.
+        scanner.skipLine();
     }
-    return { std::move(lhs), std::move(rhs) };
+    return lists;
 }
 
-int main()
+unsigned long long solve(Lists& lists)
 {
-    auto [lhs, rhs] = getInput();
-    unsigned long long totalDistance = 0; 
-    std::sort(lhs.begin(), lhs.end());
-    std::sort(rhs.begin(), rhs.end());
+    auto& [lhs, rhs] = lists;
+    assert(lhs.size() == rhs.size());
+    unsigned long long totalDistance = 0;
+    aoc::radixSort(std::span(lhs));
+    aoc::radixSort(std::span(rhs));
     for (std::size_t i = 0; i < lhs.size(); ++i)
-        totalDistance += std::abs(lhs[i] - rhs[i]);
+        totalDistance += std::max(lhs[i], rhs[i]) - std::min(lhs[i], rhs[i]);
 
-    std::cout << totalDistance << std::endl;
-    return 0;
+    return totalDistance;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& lists) { return solve(lists); });
 }
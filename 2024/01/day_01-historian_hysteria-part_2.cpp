@@ -1,49 +1,87 @@
-#include <cassert>
-#include <cctype>
-#include <charconv>
-#include <cmath>
+#include <algorithm>
 #include <cstddef>
-#include <fstream>
+#include <cstdint>
 #include <iostream>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
-#include <unordered_map>
 
-std::pair<std::vector<int>, std::vector<int>> getInput()
+#include <aoc/mapped_file.h>
+#include <aoc/radix_sort.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+
+typedef std::pair<std::vector<std::uint32_t>, std::vector<std::uint32_t>> Lists;
+
+Lists getInput()
 {
-    std::vector<std::string> lines;
-    for (std::ifstream input("day_01-historian_hysteria-input.txt");
-         std::getline(input, lines.emplace_back()); ) {
-    }
-    lines.pop_back();
-    std::vector<int> lhs(lines.size()), rhs(lines.size());
-    for (std::size_t i = 0; i < lines.size(); ++i) {
-        const char       *cursor  = lines[i].c_str(),
-                   *const lineEnd = cursor + lines[i].size();
-        const auto [ptr1, errc1] = std::from_chars(cursor, lineEnd, lhs[i]);
-        assert(errc1 == std::errc());
-        for (cursor = ptr1; isspace(*cursor); ++cursor)
+    const aoc::MappedFile file("day_01-historian_hysteria-input.txt");
+    Lists lists;
+    auto& [lhs, rhs] = lists;
+    lhs.reserve(file.view().size() / 8);
+    rhs.reserve(file.view().size() / 8);
+    for (aoc::Scanner scanner(file.view()); !scanner.atEnd(); ) {
+        std::uint32_t left = 0, right = 0;
+        bool parsed = scanner.readInt(left);
+        while (scanner.consume(' '))
             continue;
-        
-        const auto [_, errc2] = std::from_chars(cursor, lineEnd, rhs[i]);
-        assert(errc2 == std::errc());
+        parsed = parsed && scanner.readInt(right);
+        if (parsed) {
+            lhs.push_back(left);
+            rhs.push_back(right);
+        }
+
+        // Skip whatever is left of the line ('\r' of CRLF input, or all of
+        // a line that failed to parse) so that the loop always advances.
+        scanner.skipLine();
+    }
+    return lists;
+}
+
+// Largest value for which the right list's counts are kept in an array
+// indexed by value rather than by sorting both lists.
+constexpr std::uint32_t k_MaxDenseValue = 1 << 24;
+
+unsigned long long solve(const Lists& lists)
+{
+    const auto& [lhs, rhs] = lists;
+    unsigned long long totalSimilarity = 0;
+    const std::uint32_t maxValue = rhs.empty() ? 0 : std::ranges::max(rhs);
+    if (maxValue <= k_MaxDenseValue) {
+        std::vector<std::uint32_t> rhsCounts(maxValue + 1);
+        for (const auto num : rhs)
+            ++rhsCounts[num];
+
+        for (const auto num : lhs)
+            if (num <= maxValue)
+                totalSimilarity +=
+                           static_cast<unsigned long long>(num) * rhsCounts[num];
+        return totalSimilarity;
+    }
+
+    // Too sparse to count densely: merge-join the sorted lists instead,
+    // counting each run of equal values on the right once.
+    std::vector<std::uint32_t> sortedLhs(lhs), sortedRhs(rhs);
+    aoc::radixSort(std::span(sortedLhs));
+    aoc::radixSort(std::span(sortedRhs));
+    auto right = sortedRhs.begin();
+    for (auto left = sortedLhs.begin(); left != sortedLhs.end(); ) {
+        right = std::lower_bound(right, sortedRhs.end(), *left);
+        const auto rightEnd = std::upper_bound(right, sortedRhs.end(), *left);
+        const auto leftEnd  = std::upper_bound(left, sortedLhs.end(), *left);
+        totalSimilarity += static_cast<unsigned long long>(*left) *
+                           (leftEnd - left) * (rightEnd - right);
+        left  = leftEnd;
+        right = rightEnd;
     }
-    return { std::move(lhs), std::move(rhs) };
+    return totalSimilarity;
 }
 
-int main()
+int main(int argc, char *argv[])
 {
-    auto [lhs, rhs] = getInput();
-    unsigned long long totalSimilarity = 0; 
-    std::unordered_map<int, int> rhsCounts;
-    for (const auto num : rhs)
-        ++rhsCounts[num];
-
-    for (std::size_t i = 0; i < lhs.size(); ++i)
-        totalSimilarity +=
-                   static_cast<unsigned long long>(lhs[i]) * rhsCounts[lhs[i]];
-
-    std::cout << totalSimilarity << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& lists) { return solve(lists); });
 }
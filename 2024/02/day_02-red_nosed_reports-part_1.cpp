@@ -2,34 +2,110 @@
 #include <cassert>
 #include <cctype>
 #include <charconv>
-#include <cmath>
 #include <cstddef>
-#include <fstream>
+#include <cstdint>
 #include <iostream>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
-std::vector<std::vector<int>> getInput()
-{
-    std::vector<std::vector<int>> grid;
-    std::string                   line;
-    for (std::ifstream input("day_02-red_noded_reports-input.txt");
-         std::getline(input, line); ) {
-        grid.emplace_back();
-        for (const char *cursor  = line.c_str(),
-                  *const lineEnd = cursor + line.size(); cursor != lineEnd; ) {
-            const auto [ptr, errc] = std::from_chars(cursor, lineEnd,
-                                                     grid.back().emplace_back());
-            assert(errc == std::errc());
-            for (cursor = ptr; isspace(*cursor); ++cursor)
-                continue;
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+// Append the levels of the report 'line' to 'levels'.
+void parseLevels(std::string_view line, std::vector<int>& levels)
+{
+    for (const char *cursor  = line.data(),
+              *const lineEnd = cursor + line.size(); cursor != lineEnd; ) {
+        const auto [ptr, errc] = std::from_chars(cursor, lineEnd,
+                                                 levels.emplace_back());
+        assert(errc == std::errc());
+        for (cursor = ptr; (cursor != lineEnd) && isspace(*cursor); ++cursor)
+            continue;
+    }
+    assert(levels.size() >= 2);
+}
+
+// Return whether 'levels' can be stored in 'Reports': its length and every
+// level fit in a 'std::int8_t', and no level is negative, so that the
+// difference of any two levels fits too.
+bool fitsInt8(std::span<const int> levels)
+{
+    return levels.size() <= 127 &&
+           std::ranges::all_of(levels, [](int level) {
+               return 0 <= level && level <= 127;
+           });
+}
+
+// Reports stored level-major ("structure of arrays"): level 'j' of every
+// report is one contiguous row, padded to a whole number of blocks, so that
+// a block of reports is checked at once with one vector per level.  Padding
+// reports have length 0, and a report's levels past its length are 0.
+// Reports that do not fit in 'std::int8_t' (see 'fitsInt8') are left with
+// length 0 here and are kept whole in 'd_wide' for the scalar check instead.
+struct Reports {
+    static constexpr std::size_t k_BlockSize = 16;
+
+    std::size_t                   d_numReports = 0;
+    std::size_t                   d_stride     = 0;  // padded 'd_numReports'
+    std::size_t                   d_maxLength  = 0;
+    std::vector<std::int8_t>      d_lengths;         // 'd_stride' of them
+    std::vector<std::int8_t>      d_levels;          // 'd_maxLength' rows
+    std::vector<std::vector<int>> d_wide;
+
+    const std::int8_t *row(std::size_t level) const
+    {
+        return d_levels.data() + level * d_stride;
+    }
+};
+
+Reports getInput(std::string_view text)
+{
+    Reports reports;
+    reports.d_numReports = std::ranges::count(text, '\n') +
+                           (!text.empty() && !text.ends_with('\n'));
+    reports.d_stride     = (reports.d_numReports + Reports::k_BlockSize - 1) /
+                           Reports::k_BlockSize * Reports::k_BlockSize;
+    reports.d_lengths.resize(reports.d_stride);
+
+    std::vector<int> levels;
+    std::size_t      report = 0;
+    for (const std::string_view line : aoc::lines(text)) {
+        levels.clear();
+        parseLevels(line, levels);
+        if (!fitsInt8(levels)) {
+            reports.d_wide.push_back(levels);
+            ++report;
+            continue;
+        }
+        if (levels.size() > reports.d_maxLength) {
+            reports.d_maxLength = levels.size();
+            reports.d_levels.resize(reports.d_maxLength * reports.d_stride);
         }
-        assert(grid.back().size() >= 2);
+        reports.d_lengths[report] = levels.size();
+        for (std::size_t j = 0; j < levels.size(); ++j)
+            reports.d_levels[j * reports.d_stride + report] = levels[j];
+        ++report;
     }
-    return grid;
+    return reports;
 }
 
-bool isSafe(const std::vector<int>& levels)
+Reports getInput()
+{
+    const aoc::MappedFile file("day_02-red_nosed_reports-input.txt");
+    return getInput(file.view());
+}
+
+// Return whether the levels of a report all increase, or all decrease, by 1
+// to 3.
+bool isSafe(std::span<const int> levels)
 {
     assert(levels.size() >= 2);
 
@@ -43,10 +119,131 @@ bool isSafe(const std::vector<int>& levels)
         }) == levels.end();
 }
 
-int main()
+#ifdef __SSE2__
+// Return the number of safe reports among the block of 'Reports::k_BlockSize'
+// starting at 'first': each lane tracks whether its report has increased
+// safely, and whether it has decreased safely, up to the current level.
+int countSafeBlock(const Reports& reports, std::size_t first)
+{
+    const auto load = [&](std::size_t level) {
+        return _mm_loadu_si128(
+                 reinterpret_cast<const __m128i *>(reports.row(level) + first));
+    };
+    const __m128i lengths = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(reports.d_lengths.data() + first));
+    const __m128i zero = _mm_setzero_si128(), four = _mm_set1_epi8(4);
+
+    __m128i increasing = _mm_cmpeq_epi8(zero, zero), decreasing = increasing;
+    __m128i prev       = load(0);
+    for (std::size_t level = 1; level < reports.d_maxLength; ++level) {
+        const __m128i curr   = load(level);
+        const __m128i diff   = _mm_sub_epi8(curr, prev);
+        const __m128i active = _mm_cmpgt_epi8(lengths,
+                                              _mm_set1_epi8(char(level)));
+        const __m128i up     = _mm_and_si128(_mm_cmpgt_epi8(diff, zero),
+                                             _mm_cmplt_epi8(diff, four));
+        const __m128i down   = _mm_and_si128(
+                                  _mm_cmplt_epi8(diff, zero),
+                                  _mm_cmpgt_epi8(diff, _mm_sub_epi8(zero, four)));
+        increasing = _mm_andnot_si128(_mm_andnot_si128(up,   active), increasing);
+        decreasing = _mm_andnot_si128(_mm_andnot_si128(down, active), decreasing);
+        prev = curr;
+    }
+    const __m128i safe = _mm_and_si128(_mm_or_si128(increasing, decreasing),
+                                       _mm_cmpgt_epi8(lengths, zero));
+    return __builtin_popcount(_mm_movemask_epi8(safe));
+}
+#endif
+
+std::size_t solve(const Reports& reports)
+{
+    std::size_t numSafe = 0;
+#ifdef __SSE2__
+    // With every report in 'd_wide' there are no rows to load at all.
+    if (reports.d_maxLength >= 2) {
+        for (std::size_t first = 0; first < reports.d_stride;
+                                    first += Reports::k_BlockSize)
+            numSafe += countSafeBlock(reports, first);
+    }
+#else
+    std::vector<int> levels;
+    for (std::size_t i = 0; i < reports.d_numReports; ++i) {
+        if (reports.d_lengths[i] == 0)
+            continue;
+        levels.clear();
+        for (std::size_t j = 0; j < std::size_t(reports.d_lengths[i]); ++j)
+            levels.push_back(reports.row(j)[i]);
+        numSafe += isSafe(levels);
+    }
+#endif
+    for (const std::vector<int>& levels : reports.d_wide)
+        numSafe += isSafe(levels);
+    return numSafe;
+}
+
+// Count the safe reports among 'lines' as they are read, reusing one
+// report's storage for all of them.
+template <class LINES>
+std::size_t solveStreaming(LINES&& lines)
+{
+    std::size_t      numSafe = 0;
+    std::vector<int> levels;
+    for (const std::string_view line : lines) {
+        levels.clear();
+        parseLevels(line, levels);
+        numSafe += isSafe(levels);
+    }
+    return numSafe;
+}
+
+void check(int                     lineNumber,
+           std::size_t             expectedNumSafe,
+           const std::string_view& source)
+{
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto numSafe = solve(getInput(source));
+            numSafe != expectedNumSafe) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumSafe
+                                  << "\n> actual:   " << numSafe
+                                  << std::endl;
+        }
+        if (const auto numSafe = solveStreaming(aoc::lines(source));
+            numSafe != expectedNumSafe) {
+            *aoc::failureStream() << "failure(" << lineNumber << ", streaming):"
+                                  << "\n> expected: " << expectedNumSafe
+                                  << "\n> actual:   " << numSafe
+                                  << std::endl;
+        }
+    });
+}
+
+void runTests()
 {
-    const auto grid    = getInput();
-    const auto numSafe = std::count_if(grid.begin(), grid.end(), &isSafe);
-    std::cout << numSafe << std::endl;
-    return 0;
+    check(__LINE__, 2,
+          "7 6 4 2 1\n"
+          "1 2 7 8 9\n"
+          "9 7 6 2 1\n"
+          "1 3 2 4 5\n"
+          "8 6 4 4 1\n"
+          "1 3 6 7 9\n");
+
+    // Every report too wide for 'std::int8_t'.
+    check(__LINE__, 1,
+          "200 201 202\n"
+          "300 299 298 1\n");
+}
+
+int main(int argc, char *argv[])
+{
+    runTests();
+
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& grid) { return solve(grid); },
+        [] {
+            return solveStreaming(
+                     aoc::LineReader("day_02-red_nosed_reports-input.txt"));
+        });
 }
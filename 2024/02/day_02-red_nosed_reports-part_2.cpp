@@ -2,74 +2,296 @@
 #include <cassert>
 #include <cctype>
 #include <charconv>
-#include <cmath>
 #include <cstddef>
-#include <fstream>
+#include <cstdint>
 #include <iostream>
-#include <iterator>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
-std::vector<std::vector<int>> getInput()
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+// Append the levels of the report 'line' to 'levels'.
+void parseLevels(std::string_view line, std::vector<int>& levels)
+{
+    for (const char *cursor  = line.data(),
+              *const lineEnd = cursor + line.size(); cursor != lineEnd; ) {
+        const auto [ptr, errc] = std::from_chars(cursor, lineEnd,
+                                                 levels.emplace_back());
+        assert(errc == std::errc());
+        for (cursor = ptr; (cursor != lineEnd) && isspace(*cursor); ++cursor)
+            continue;
+    }
+    assert(levels.size() >= 2);
+}
+
+// Return whether 'levels' can be stored in 'Reports': its length and every
+// level fit in a 'std::int8_t', and no level is negative, so that the
+// difference of any two levels fits too.
+bool fitsInt8(std::span<const int> levels)
+{
+    return levels.size() <= 127 &&
+           std::ranges::all_of(levels, [](int level) {
+               return 0 <= level && level <= 127;
+           });
+}
+
+// Reports stored level-major ("structure of arrays"): level 'j' of every
+// report is one contiguous row, padded to a whole number of blocks, so that
+// a block of reports is checked at once with one vector per level.  Padding
+// reports have length 0, and a report's levels past its length are 0.
+// Reports that do not fit in 'std::int8_t' (see 'fitsInt8') are left with
+// length 0 here and are kept whole in 'd_wide' for the scalar check instead.
+struct Reports {
+    static constexpr std::size_t k_BlockSize = 16;
+
+    std::size_t                   d_numReports = 0;
+    std::size_t                   d_stride     = 0;  // padded 'd_numReports'
+    std::size_t                   d_maxLength  = 0;
+    std::vector<std::int8_t>      d_lengths;         // 'd_stride' of them
+    std::vector<std::int8_t>      d_levels;          // 'd_maxLength' rows
+    std::vector<std::vector<int>> d_wide;
+
+    const std::int8_t *row(std::size_t level) const
+    {
+        return d_levels.data() + level * d_stride;
+    }
+};
+
+Reports getInput(std::string_view text)
 {
-    std::vector<std::vector<int>> grid;
-    std::string                   line;
-    for (std::ifstream input("day_02-red_nosed_reports-input.txt");
-         std::getline(input, line); ) {
-        grid.emplace_back();
-        for (const char *cursor  = line.c_str(),
-                  *const lineEnd = cursor + line.size(); cursor != lineEnd; ) {
-            const auto [ptr, errc] = std::from_chars(cursor, lineEnd,
-                                                     grid.back().emplace_back());
-            assert(errc == std::errc());
-            for (cursor = ptr; isspace(*cursor); ++cursor)
-                continue;
+    Reports reports;
+    reports.d_numReports = std::ranges::count(text, '\n') +
+                           (!text.empty() && !text.ends_with('\n'));
+    reports.d_stride     = (reports.d_numReports + Reports::k_BlockSize - 1) /
+                           Reports::k_BlockSize * Reports::k_BlockSize;
+    reports.d_lengths.resize(reports.d_stride);
+
+    std::vector<int> levels;
+    std::size_t      report = 0;
+    for (const std::string_view line : aoc::lines(text)) {
+        levels.clear();
+        parseLevels(line, levels);
+        if (!fitsInt8(levels)) {
+            reports.d_wide.push_back(levels);
+            ++report;
+            continue;
         }
-        assert(grid.back().size() >= 2);
+        if (levels.size() > reports.d_maxLength) {
+            reports.d_maxLength = levels.size();
+            reports.d_levels.resize(reports.d_maxLength * reports.d_stride);
+        }
+        reports.d_lengths[report] = levels.size();
+        for (std::size_t j = 0; j < levels.size(); ++j)
+            reports.d_levels[j * reports.d_stride + report] = levels[j];
+        ++report;
     }
-    return grid;
+    return reports;
 }
 
-std::pair<int, int> findUnsafe(const std::vector<int>& levels, int drop)
+Reports getInput()
+{
+    const aoc::MappedFile file("day_02-red_nosed_reports-input.txt");
+    return getInput(file.view());
+}
+
+// Return whether the levels of a report all increase, or all decrease, by 1
+// to 3 once at most one of them is removed, in one pass per direction.  After
+// level 'i', 'kept' is whether levels '0..i' are safe as they are,
+// 'keptBefore' the same up to 'i - 1', and 'dropped' whether they are safe
+// ending at level 'i' with one earlier level removed.
+bool isSafe(std::span<const int> levels)
 {
     assert(levels.size() >= 2);
 
-    int l = 0;
-    l += (l == drop);
-    int r = l + 1;
-    r += (r == drop);
-    int minDiff = 1, maxDiff = 3;
-    if (levels[l] > levels[r])
-        minDiff = -3, maxDiff = -1;
-    do {
-        const int diff = levels[r] - levels[l];
-        if ((diff < minDiff) || (diff > maxDiff))
-            return std::make_pair(l, r);
-
-        l = r++;
-        r += (r == drop);
-    } while (r < levels.size());
-    return std::make_pair(-1, -1);
+    for (const int sign : { 1, -1 }) {
+        const auto good = [=](std::size_t from, std::size_t to) {
+            const int diff = sign * (levels[to] - levels[from]);
+            return (diff >= 1) && (diff <= 3);
+        };
+        bool kept = good(0, 1), keptBefore = true, dropped = true;
+        for (std::size_t i = 2; i < levels.size(); ++i) {
+            dropped    = (dropped && good(i - 1, i)) ||
+                         (keptBefore && good(i - 2, i));
+            keptBefore = std::exchange(kept, kept && good(i - 1, i));
+        }
+        if (kept || dropped || keptBefore)
+            return true;
+    }
+    return false;
 }
 
-bool isSafe(const std::vector<int>& levels)
+#ifdef __SSE2__
+// Masks of the lanes whose differences are safe steps upwards and downwards.
+struct Steps {
+    __m128i d_up;
+    __m128i d_down;
+};
+
+Steps safeSteps(__m128i diff)
 {
-    assert(levels.size() >= 2);
+    const __m128i zero = _mm_setzero_si128(), four = _mm_set1_epi8(4);
+    return { _mm_and_si128(_mm_cmpgt_epi8(diff, zero),
+                           _mm_cmplt_epi8(diff, four)),
+             _mm_and_si128(_mm_cmplt_epi8(diff, zero),
+                           _mm_cmpgt_epi8(diff, _mm_sub_epi8(zero, four))) };
+}
+
+// Return the lanes of 'next' where 'active' is set, and of 'prev' elsewhere.
+__m128i select(__m128i active, __m128i next, __m128i prev)
+{
+    return _mm_or_si128(_mm_and_si128(active, next),
+                        _mm_andnot_si128(active, prev));
+}
+
+// Return the number of safe reports among the block of 'Reports::k_BlockSize'
+// starting at 'first', running the pass of 'isSafe' in every lane at once,
+// both directions side by side.
+int countSafeBlock(const Reports& reports, std::size_t first)
+{
+    const auto load = [&](std::size_t level) {
+        return _mm_loadu_si128(
+                 reinterpret_cast<const __m128i *>(reports.row(level) + first));
+    };
+    const __m128i lengths = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(reports.d_lengths.data() + first));
+    const __m128i ones = _mm_cmpeq_epi8(lengths, lengths);
+
+    __m128i prev2 = load(0), prev = load(1);
+    const auto [up, down] = safeSteps(_mm_sub_epi8(prev, prev2));
+    __m128i keptUp   = up,   keptBeforeUp   = ones, droppedUp   = ones;
+    __m128i keptDown = down, keptBeforeDown = ones, droppedDown = ones;
+    for (std::size_t level = 2; level < reports.d_maxLength; ++level) {
+        const __m128i curr   = load(level);
+        const __m128i active = _mm_cmpgt_epi8(lengths,
+                                              _mm_set1_epi8(char(level)));
+        const auto [up1, down1] = safeSteps(_mm_sub_epi8(curr, prev));
+        const auto [up2, down2] = safeSteps(_mm_sub_epi8(curr, prev2));
+
+        droppedUp      = select(active,
+                                _mm_or_si128(_mm_and_si128(droppedUp, up1),
+                                             _mm_and_si128(keptBeforeUp, up2)),
+                                droppedUp);
+        keptBeforeUp   = select(active, keptUp, keptBeforeUp);
+        keptUp         = select(active, _mm_and_si128(keptUp, up1), keptUp);
+
+        droppedDown    = select(active,
+                                _mm_or_si128(_mm_and_si128(droppedDown, down1),
+                                             _mm_and_si128(keptBeforeDown,
+                                                           down2)),
+                                droppedDown);
+        keptBeforeDown = select(active, keptDown, keptBeforeDown);
+        keptDown       = select(active, _mm_and_si128(keptDown, down1),
+                                keptDown);
+
+        prev2 = std::exchange(prev, curr);
+    }
+    __m128i safe = _mm_or_si128(_mm_or_si128(keptUp, keptBeforeUp),
+                                _mm_or_si128(keptDown, keptBeforeDown));
+    safe = _mm_or_si128(safe, _mm_or_si128(droppedUp, droppedDown));
+    safe = _mm_and_si128(safe, _mm_cmpgt_epi8(lengths, _mm_setzero_si128()));
+    return __builtin_popcount(_mm_movemask_epi8(safe));
+}
+#endif
+
+std::size_t solve(const Reports& reports)
+{
+    std::size_t numSafe = 0;
+#ifdef __SSE2__
+    // With every report in 'd_wide' there are no rows to load at all.
+    if (reports.d_maxLength >= 2) {
+        for (std::size_t first = 0; first < reports.d_stride;
+                                    first += Reports::k_BlockSize)
+            numSafe += countSafeBlock(reports, first);
+    }
+#else
+    std::vector<int> levels;
+    for (std::size_t i = 0; i < reports.d_numReports; ++i) {
+        if (reports.d_lengths[i] == 0)
+            continue;
+        levels.clear();
+        for (std::size_t j = 0; j < std::size_t(reports.d_lengths[i]); ++j)
+            levels.push_back(reports.row(j)[i]);
+        numSafe += isSafe(levels);
+    }
+#endif
+    for (const std::vector<int>& levels : reports.d_wide)
+        numSafe += isSafe(levels);
+    return numSafe;
+}
 
-    const auto [bad1, bad2] = findUnsafe(levels, -1);
-    return ((bad1 < 0)                           ||
-            (findUnsafe(levels, bad1).first < 0) ||
-            (findUnsafe(levels, bad2).first < 0)) ||
-           ((bad1 != 0)                       &&
-            (findUnsafe(levels, 0).first < 0) ||
-            ((bad1 != 1) && (findUnsafe(levels, 1).first < 0)));
+// Count the safe reports among 'lines' as they are read, reusing one
+// report's storage for all of them.
+template <class LINES>
+std::size_t solveStreaming(LINES&& lines)
+{
+    std::size_t      numSafe = 0;
+    std::vector<int> levels;
+    for (const std::string_view line : lines) {
+        levels.clear();
+        parseLevels(line, levels);
+        numSafe += isSafe(levels);
+    }
+    return numSafe;
 }
 
-int main()
+void check(int                     lineNumber,
+           std::size_t             expectedNumSafe,
+           const std::string_view& source)
 {
-    const auto grid    = getInput();
-    const auto numSafe = std::count_if(grid.begin(), grid.end(), &isSafe);
-    std::cout << numSafe << std::endl;
-    return 0;
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto numSafe = solve(getInput(source));
+            numSafe != expectedNumSafe) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumSafe
+                                  << "\n> actual:   " << numSafe
+                                  << std::endl;
+        }
+        if (const auto numSafe = solveStreaming(aoc::lines(source));
+            numSafe != expectedNumSafe) {
+            *aoc::failureStream() << "failure(" << lineNumber << ", streaming):"
+                                  << "\n> expected: " << expectedNumSafe
+                                  << "\n> actual:   " << numSafe
+                                  << std::endl;
+        }
+    });
+}
+
+void runTests()
+{
+    check(__LINE__, 4,
+          "7 6 4 2 1\n"
+          "1 2 7 8 9\n"
+          "9 7 6 2 1\n"
+          "1 3 2 4 5\n"
+          "8 6 4 4 1\n"
+          "1 3 6 7 9\n");
+
+    // Every report too wide for 'std::int8_t'.
+    check(__LINE__, 2,
+          "200 201 202\n"
+          "300 299 298 1\n");
+}
+
+int main(int argc, char *argv[])
+{
+    runTests();
+
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& grid) { return solve(grid); },
+        [] {
+            return solveStreaming(
+                     aoc::LineReader("day_02-red_nosed_reports-input.txt"));
+        });
 }
@@ -1,30 +1,48 @@
 #include <cassert>
-#include <numeric>
-#include <functional>
-#include <fstream>
 #include <iostream>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <string_view>
 
-std::string getInput()
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+
+aoc::MappedFile getInput()
+{
+    return aoc::MappedFile("day_03-mull_it_over-input.txt");
+}
+
+// If a complete 'mul(X,Y)' instruction with 1- to 3-digit operands starts at
+// the cursor, consume it and load 'X*Y' into 'product'.
+bool readMul(aoc::Scanner& scanner, unsigned long long& product)
+{
+    aoc::Scanner attempt = scanner;
+    unsigned long long x, y;
+    if (!(attempt.consume("mul(") &&
+          attempt.readInt(x, 3) && attempt.consume(',') &&
+          attempt.readInt(y, 3) && attempt.consume(')')))
+        return false;
+
+    product = x * y;
+    scanner = attempt;
+    return true;
+}
+
+unsigned long long solve(const std::string_view& input)
 {
-    std::ifstream      input("day_03-mull_it_over-input.txt");
-    std::ostringstream str;
-    str << input.rdbuf();
-    return str.str();
+    unsigned long long total = 0;
+    for (aoc::Scanner scanner(input); scanner.skipTo('m'); ) {
+        if (unsigned long long product; readMul(scanner, product))
+            total += product;
+        else
+            scanner.advance();
+    }
+    return total;
 }
 
-int main()
+int main(int argc, char *argv[])
 {
-    const std::string input = getInput();
-    const std::regex  matcher("mul\\(([0-9]{1,3}),([0-9]{1,3})\\)");
-    const std::sregex_iterator mBegin(input.begin(), input.end(), matcher), mEnd;
-    const auto total = std::transform_reduce(mBegin, mEnd, 0ULL, std::plus{},
-                                             [](const auto& match) {
-        assert(match.size() == 3);
-        return std::stoull(match[1]) * std::stoull(match[2]);
-    });
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& file) { return solve(file.view()); });
 }
@@ -1,40 +1,104 @@
 #include <cassert>
-#include <numeric>
-#include <functional>
-#include <fstream>
+#include <cstddef>
 #include <iostream>
-#include <regex>
-#include <sstream>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
-std::string getInput()
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+#include <aoc/thread_pool.h>
+
+aoc::MappedFile getInput()
 {
-    std::ifstream      input("day_03-mull_it_over-input.txt");
-    std::ostringstream str;
-    str << input.rdbuf();
-    return str.str();
+    return aoc::MappedFile("day_03-mull_it_over-input.txt");
 }
 
-int main()
+// If a complete 'mul(X,Y)' instruction with 1- to 3-digit operands starts at
+// the cursor, consume it and load 'X*Y' into 'product'.
+bool readMul(aoc::Scanner& scanner, unsigned long long& product)
 {
-    const std::string input = getInput();
-    const std::regex  matcher("mul\\(([0-9]{1,3}),([0-9]{1,3})\\)|do\\(\\)|don't\\(\\)");
-    unsigned long long total = 0;
-    bool enabled = true;
-    for (std::sregex_iterator m(input.begin(), input.end(), matcher), mEnd; m != mEnd; ++m) {
-        assert(m->size() == 3);
-
-        const auto matchStr = m->str();
-        if (matchStr == "do()") {
-            enabled = true;
+    aoc::Scanner attempt = scanner;
+    unsigned long long x, y;
+    if (!(attempt.consume("mul(") &&
+          attempt.readInt(x, 3) && attempt.consume(',') &&
+          attempt.readInt(y, 3) && attempt.consume(')')))
+        return false;
+
+    product = x * y;
+    scanner = attempt;
+    return true;
+}
+
+// Sums of the enabled products of the instructions starting in one chunk of
+// the input, for either state that the chunk may be entered in, and the
+// state it leaves behind, if it has any 'do()' or 'don't()'.
+struct ChunkResult {
+    unsigned long long  d_totalIfEntered[2] = {};  // by initial 'enabled'
+    std::optional<bool> d_exitEnabled;
+};
+
+// Scan the instructions of 'input' that start before its 'chunkEnd'-th
+// character (those straddling it are read to their end).  Products before the
+// first 'do()' or 'don't()' count only if the chunk is entered enabled; the
+// state is known from there on.
+ChunkResult scanChunk(std::string_view input, std::size_t chunkEnd)
+{
+    ChunkResult result;
+    const char *const end = input.data() + chunkEnd;
+    for (aoc::Scanner scanner(input);
+         scanner.skipToAny("md") && scanner.rest().data() < end; ) {
+        unsigned long long product;
+        if (scanner.consume("do()")) {
+            result.d_exitEnabled = true;
+        }
+        else if (scanner.consume("don't()")) {
+            result.d_exitEnabled = false;
         }
-        else if (matchStr == "don't()") {
-            enabled = false;
+        else if (readMul(scanner, product)) {
+            if (!result.d_exitEnabled) {
+                result.d_totalIfEntered[true] += product;
+            }
+            else if (*result.d_exitEnabled) {
+                result.d_totalIfEntered[false] += product;
+                result.d_totalIfEntered[true]  += product;
+            }
         }
-        else if (enabled) {
-            total += (std::stoull((*m)[1]) * std::stoull((*m)[2]));
+        else {
+            scanner.advance();
         }
     }
-    std::cout << total << std::endl;
-    return 0;
+    return result;
+}
+
+// Smallest chunk of the input, in bytes, worth a thread of its own.
+constexpr std::size_t k_MinChunkSize = 1 << 20;
+
+unsigned long long solve(const std::string_view& input)
+{
+    // Stitch the chunks together left to right, carrying the total and
+    // whether 'mul's are enabled.
+    typedef std::pair<unsigned long long, bool> State;
+    return aoc::parallelReduce(
+        input.size(),
+        k_MinChunkSize,
+        State(0, true),
+        [&](std::size_t begin, std::size_t end) {
+            return scanChunk(input.substr(begin), end - begin);
+        },
+        [](const State& state, const ChunkResult& result) {
+            const auto [total, enabled] = state;
+            return State(total + result.d_totalIfEntered[enabled],
+                         result.d_exitEnabled.value_or(enabled));
+        }).first;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& file) { return solve(file.view()); });
 }
@@ -1,49 +1,140 @@
 #include <algorithm>
+#include <bit>
 #include <cassert>
-#include <fstream>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
+#include <aoc/aho_corasick.h>
+#include <aoc/grid_search.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 std::vector<std::string> getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream input("day_04-ceres_search-input.txt");
-         std::getline(input, grid.emplace_back()); )
-        continue;
-
-    assert(!grid.empty());
-    grid.pop_back();
+    const aoc::MappedFile file("day_04-ceres_search-input.txt");
+    const auto rows = aoc::lines(file.view());
+    std::vector<std::string> grid(rows.begin(), rows.end());
     assert(!grid.empty());
     return grid;
 }
 
-bool isMatch(const std::vector<std::string>&  grid,
-             const char                      *word,
-             int i, int j, int x, int y)
-{
-    while ((i >= 0) && (i < grid.size()) &&
-           (j >= 0) && (j < grid[i].size()) &&
-           (*word == grid[i][j])) {
-        ++word;
-        i += x;
-        j += y;
+// The grid as one bitplane per letter of "XMAS": bit 'j % 64' of word
+// 'j / 64' of a row is set if the row's 'j'-th cell holds that letter.  Rows
+// are padded with zero words on both sides and with 'k_Padding' zero rows
+// above and below, so that neighbors up to that far off are read without
+// bounds checks.
+class BitPlanes {
+  public:
+    static constexpr int k_Padding = 3;
+
+    explicit BitPlanes(const std::vector<std::string>& grid)
+        : d_numRows(grid.size())
+        , d_numWords((grid[0].size() + 63) / 64)
+        , d_stride(d_numWords + 2)
+        , d_words(4 * (d_numRows + 2 * k_Padding) * d_stride, 0)
+    {
+        for (int i = 0; i < d_numRows; ++i) {
+            for (std::size_t j = 0; j < grid[i].size(); ++j) {
+                if (const int letter = letterIndex(grid[i][j]); letter >= 0)
+                    row(letter, i)[j / 64] |= std::uint64_t(1) << (j % 64);
+            }
+        }
+    }
+
+    int numRows()  const { return d_numRows; }
+    int numWords() const { return d_numWords; }
+
+    // Return the index of 'c' in "XMAS", or -1.
+    static int letterIndex(char c)
+    {
+        switch (c) {
+          case 'X': return 0;
+          case 'M': return 1;
+          case 'A': return 2;
+          case 'S': return 3;
+        }
+        return -1;
+    }
+
+    // Return the words of 'row' (from '-k_Padding' to 'numRows() +
+    // k_Padding - 1') of the plane of 'letter'; index -1 and 'numWords()'
+    // are padding.
+    const std::uint64_t *row(int letter, int row) const
+    {
+        return d_words.data() +
+               (letter * (d_numRows + 2 * k_Padding) + row + k_Padding) *
+                                                                  d_stride + 1;
+    }
+
+    // Return word 'w' of 'row' shifted by 'shift' (-63 to 63) columns: its
+    // bit 'b' is the bit of column '64 * w + b + shift'.
+    static std::uint64_t shifted(const std::uint64_t *row, int w, int shift)
+    {
+        if (shift > 0)
+            return (row[w] >> shift) | (row[w + 1] << (64 - shift));
+        if (shift < 0)
+            return (row[w] << -shift) | (row[w - 1] >> (64 + shift));
+        return row[w];
     }
-    return *word == '\0';
+
+  private:
+    std::uint64_t *row(int letter, int row)
+    {
+        return const_cast<std::uint64_t *>(
+                        std::as_const(*this).row(letter, row));
+    }
+
+    int                        d_numRows;
+    int                        d_numWords;
+    int                        d_stride;
+    std::vector<std::uint64_t> d_words;
+};
+
+int solve(const std::vector<std::string>& grid)
+{
+    const std::string_view words[] = { "XMAS" };
+    const aoc::AhoCorasick automaton(words);
+    int total = 0;
+    aoc::searchGrid(grid, automaton, aoc::k_AllDirections,
+                    [&](auto, int, int, aoc::Direction) { ++total; });
+
+    return total;
 }
 
-int main()
+// Count "XMAS" 64 cells at a time: for each direction, the X plane of a row
+// ANDed with the M, A and S planes of the rows one, two and three steps on,
+// shifted by as many columns, marks the cells where an "XMAS" starts.
+int solveBitPlanes(const std::vector<std::string>& grid)
 {
-    std::vector<std::string> grid = getInput();
-    const int k_NumRows = grid.size(), k_NumCols = grid[0].size();
+    const BitPlanes planes(grid);
     int total = 0;
-    for (int i = 0; i < k_NumRows; ++i)
-        for (int j = 0; j < k_NumCols; ++j)
-            for (int x = -1; x <= +1; ++x)
-                for (int y = -1; y <= +1; y += 1 + (x == 0))
-                    total += isMatch(grid, "XMAS", i, j, x, y);
-
-    std::cout << total << std::endl;
-    return 0;
+    for (const auto [dRow, dCol] : aoc::k_AllDirections) {
+        for (int i = 0; i < planes.numRows(); ++i) {
+            const std::uint64_t *const x = planes.row(0, i),
+                                *const m = planes.row(1, i +     dRow),
+                                *const a = planes.row(2, i + 2 * dRow),
+                                *const s = planes.row(3, i + 3 * dRow);
+            for (int w = 0; w < planes.numWords(); ++w)
+                total += std::popcount(x[w]                              &
+                                       BitPlanes::shifted(m, w,     dCol) &
+                                       BitPlanes::shifted(a, w, 2 * dCol) &
+                                       BitPlanes::shifted(s, w, 3 * dCol));
+        }
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) {
+                        return aoc::mode() == "bitplanes" ? solveBitPlanes(grid)
+                                                          : solve(grid);
+                    });
 }
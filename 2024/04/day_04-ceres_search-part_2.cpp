@@ -1,56 +1,148 @@
 #include <algorithm>
+#include <bit>
 #include <cassert>
-#include <fstream>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
+#include <aoc/aho_corasick.h>
+#include <aoc/grid_search.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 std::vector<std::string> getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream input("day_04-ceres_search-input.txt");
-         std::getline(input, grid.emplace_back()); )
-        continue;
-
-    assert(!grid.empty());
-    grid.pop_back();
+    const aoc::MappedFile file("day_04-ceres_search-input.txt");
+    const auto rows = aoc::lines(file.view());
+    std::vector<std::string> grid(rows.begin(), rows.end());
     assert(!grid.empty());
     return grid;
 }
 
-bool isMatch(const std::vector<std::string>&  grid,
-             const char                      *word,
-             int i, int j, int x, int y)
-{
-    while ((i >= 0) && (i < grid.size()) &&
-           (j >= 0) && (j < grid[i].size()) &&
-           (*word == grid[i][j])) {
-        ++word;
-        i += x;
-        j += y;
+// The grid as one bitplane per letter of "XMAS": bit 'j % 64' of word
+// 'j / 64' of a row is set if the row's 'j'-th cell holds that letter.  Rows
+// are padded with zero words on both sides and with 'k_Padding' zero rows
+// above and below, so that neighbors up to that far off are read without
+// bounds checks.
+class BitPlanes {
+  public:
+    static constexpr int k_Padding = 3;
+
+    explicit BitPlanes(const std::vector<std::string>& grid)
+        : d_numRows(grid.size())
+        , d_numWords((grid[0].size() + 63) / 64)
+        , d_stride(d_numWords + 2)
+        , d_words(4 * (d_numRows + 2 * k_Padding) * d_stride, 0)
+    {
+        for (int i = 0; i < d_numRows; ++i) {
+            for (std::size_t j = 0; j < grid[i].size(); ++j) {
+                if (const int letter = letterIndex(grid[i][j]); letter >= 0)
+                    row(letter, i)[j / 64] |= std::uint64_t(1) << (j % 64);
+            }
+        }
+    }
+
+    int numRows()  const { return d_numRows; }
+    int numWords() const { return d_numWords; }
+
+    // Return the index of 'c' in "XMAS", or -1.
+    static int letterIndex(char c)
+    {
+        switch (c) {
+          case 'X': return 0;
+          case 'M': return 1;
+          case 'A': return 2;
+          case 'S': return 3;
+        }
+        return -1;
+    }
+
+    // Return the words of 'row' (from '-k_Padding' to 'numRows() +
+    // k_Padding - 1') of the plane of 'letter'; index -1 and 'numWords()'
+    // are padding.
+    const std::uint64_t *row(int letter, int row) const
+    {
+        return d_words.data() +
+               (letter * (d_numRows + 2 * k_Padding) + row + k_Padding) *
+                                                                  d_stride + 1;
     }
-    return *word == '\0';
-}
 
-int main()
+    // Return word 'w' of 'row' shifted by 'shift' (-63 to 63) columns: its
+    // bit 'b' is the bit of column '64 * w + b + shift'.
+    static std::uint64_t shifted(const std::uint64_t *row, int w, int shift)
+    {
+        if (shift > 0)
+            return (row[w] >> shift) | (row[w + 1] << (64 - shift));
+        if (shift < 0)
+            return (row[w] << -shift) | (row[w - 1] >> (64 + shift));
+        return row[w];
+    }
+
+  private:
+    std::uint64_t *row(int letter, int row)
+    {
+        return const_cast<std::uint64_t *>(
+                        std::as_const(*this).row(letter, row));
+    }
+
+    int                        d_numRows;
+    int                        d_numWords;
+    int                        d_stride;
+    std::vector<std::uint64_t> d_words;
+};
+
+int solve(const std::vector<std::string>& grid)
 {
-    const std::vector<std::string> grid = getInput();
     const int k_NumRows = grid.size(), k_NumCols = grid[0].size();
-    std::vector<std::vector<char>> mids(k_NumRows,
-                                        std::vector<char>(k_NumCols, 0));
-    for (int i = 0; i < k_NumRows; ++i)
-        for (int j = 0; j < k_NumCols; ++j)
-            for (int x = -1; x <= +1; x += 2)
-                for (int y = -1; y <= +1; y += 2)
-                    if (isMatch(grid, "MAS", i, j, x, y))
-                        ++mids[i+x][j+y];
+    const std::string_view words[] = { "MAS" };
+    const aoc::AhoCorasick automaton(words);
+    std::vector<char> mids(k_NumRows * k_NumCols, 0);
+    aoc::searchGrid(grid, automaton, aoc::k_DiagonalDirections,
+                    [&](auto, int i, int j, aoc::Direction direction) {
+                        ++mids[(i + direction.d_row) * k_NumCols +
+                               (j + direction.d_col)];
+                    });
 
+    return std::ranges::count(mids, 2);
+}
+
+// Count X-MAS crosses 64 cells at a time: a cell of the A plane is the
+// middle of one if, on each diagonal through it, one neighbor's M plane and
+// the opposite neighbor's S plane are set.
+int solveBitPlanes(const std::vector<std::string>& grid)
+{
+    const BitPlanes planes(grid);
     int total = 0;
-    for (int i = 0; i < k_NumRows; ++i)
-        for (int j = 0; j < k_NumCols; ++j)
-            total += (mids[i][j] == 2);
+    for (int i = 0; i < planes.numRows(); ++i) {
+        const std::uint64_t *const a     = planes.row(2, i),
+                            *const mUp   = planes.row(1, i - 1),
+                            *const sUp   = planes.row(3, i - 1),
+                            *const mDown = planes.row(1, i + 1),
+                            *const sDown = planes.row(3, i + 1);
+        for (int w = 0; w < planes.numWords(); ++w) {
+            using B = BitPlanes;
+            const std::uint64_t falling =
+                          (B::shifted(mUp, w, -1) & B::shifted(sDown, w, +1)) |
+                          (B::shifted(sUp, w, -1) & B::shifted(mDown, w, +1));
+            const std::uint64_t rising =
+                          (B::shifted(mUp, w, +1) & B::shifted(sDown, w, -1)) |
+                          (B::shifted(sUp, w, +1) & B::shifted(mDown, w, -1));
+            total += std::popcount(a[w] & falling & rising);
+        }
+    }
+    return total;
+}
 
-    std::cout << total << std::endl;
-    return 0;
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) {
+                        return aoc::mode() == "bitplanes" ? solveBitPlanes(grid)
+                                                          : solve(grid);
+                    });
 }
@@ -1,34 +1,41 @@
 #include <algorithm>
 #include <cassert>
 #include <charconv>
-#include <fstream>
-#include <iomanip>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/thread_pool.h>
+
 std::pair<std::vector<std::pair<int, int>>,
           std::vector<std::vector<int>>> getInput()
 {
     std::pair<std::vector<std::pair<int, int>>,
               std::vector<std::vector<int>>> result;
     auto& [edges, orderings] = result;
-    std::ifstream input("day_05-print_queue-input.txt");
-    std::string   line;
-    while (std::getline(input, line) && !line.empty()) {
-        const char *c = line.c_str(), *const cEnd = c + line.size();
+    const aoc::MappedFile file("day_05-print_queue-input.txt");
+    const auto            lines = aoc::lines(file.view());
+    auto                  it    = lines.begin();
+    for (std::string_view line; (it != lines.end()) && !(line = *it).empty();
+         ++it) {
+        const char *c = line.data(), *const cEnd = c + line.size();
         auto& [prev, next] = edges.emplace_back();
         const auto [ptr1, ec1] = std::from_chars(c, cEnd, prev);
         assert(ec1 == std::errc());
-        const auto [ptr2, ec2] = std::from_chars(ptr1+1, cEnd, next);
+        [[maybe_unused]] const auto [ptr2, ec2] =
+                                        std::from_chars(ptr1+1, cEnd, next);
         assert(ec2 == std::errc());
     }
-    while (std::getline(input, line)) {
-        const char *c = line.c_str(), *const cEnd = c + line.size();
+    for (++it; it != lines.end(); ++it) {
+        const std::string_view line = *it;
+        const char *c = line.data(), *const cEnd = c + line.size();
         auto& ordering = orderings.emplace_back();
         while (true) {
             int num;
@@ -44,84 +51,77 @@ std::pair<std::vector<std::pair<int, int>>,
     return result;
 }
 
-bool isOrdered(const std::unordered_map<int, std::vector<int>>& graph,
-               const std::vector<int>&                          ordering)
-{
-    std::unordered_map<int, int> ingress;
-    for (const int num : ordering)
-        ingress[num] = 0;
-
-    for (const int num : ordering)
-        if (auto foundNext = graph.find(num); foundNext != graph.end())
-            for (const int next : foundNext->second)
-                if (auto it = ingress.find(next); it != ingress.end())
-                    ++it->second;
+// The page ordering rules compiled into a dense matrix of bits, one row per
+// page: 'precedes(x, y)' is whether a rule puts page 'x' before page 'y'.
+class PrecedenceMatrix {
+  public:
+    explicit PrecedenceMatrix(const std::vector<std::pair<int, int>>& rules)
+    {
+        for (const auto& [prev, next] : rules) {
+            assert(prev >= 0 && next >= 0);
+            d_numPages = std::max({ d_numPages, prev + 1, next + 1 });
+        }
+        d_numWords = (d_numPages + 63) / 64;
+        d_bits.assign(std::size_t(d_numPages) * d_numWords, 0);
+        for (const auto& [prev, next] : rules)
+            d_bits[prev * d_numWords + next / 64] |=
+                                              std::uint64_t(1) << (next % 64);
+    }
 
-    for (const int num : ordering) {
-        if (ingress[num] != 0)
-            return false;
+    bool precedes(int x, int y) const
+    {
+        return (x < d_numPages) && (y < d_numPages) &&
+               ((d_bits[x * d_numWords + y / 64] >> (y % 64)) & 1);
+    }
 
-        const auto foundNext = graph.find(num);
-        if (foundNext == graph.end())
-            continue;
+  private:
+    int                        d_numPages = 0;
+    int                        d_numWords = 0;
+    std::vector<std::uint64_t> d_bits;
+};
 
-        for (const int next : foundNext->second)
-            if (auto it = ingress.find(next); it != ingress.end())
-                --it->second;
-    }
-    return true;
+// Return whether no rule puts a page of 'ordering' before the one preceding
+// it.  As the rules order every pair of pages in an update, checking the
+// adjacent pairs is enough.
+bool isOrdered(const PrecedenceMatrix& rules, const std::vector<int>& ordering)
+{
+    return std::ranges::adjacent_find(ordering, [&](int prev, int next) {
+               return rules.precedes(next, prev);
+           }) == ordering.end();
 }
 
-void order(std::vector<int>&                                ordering,
-           const std::unordered_map<int, std::vector<int>>& graph)
+// Fewest updates worth handing to a thread of the pool.
+constexpr std::size_t k_MinChunkSize = 1024;
+
+int solve(const std::vector<std::pair<int, int>>& edges,
+          std::vector<std::vector<int>>&          orderings)
 {
-    std::unordered_set<int> roots(ordering.begin(), ordering.end());
-    std::unordered_map<int, int> ingress;
-    for (const int num : ordering) {
-        ingress[num] = 0;
-        roots.insert(num);
-    }
-    for (const int num : ordering) {
-        if (auto foundNext = graph.find(num); foundNext != graph.end()) {
-            for (const int next : foundNext->second) {
-                if (auto it = ingress.find(next); it != ingress.end()) {
-                    ++it->second;
-                    roots.erase(next);
+    const PrecedenceMatrix rules(edges);
+    const auto             precedes = [&](int x, int y) {
+        return rules.precedes(x, y);
+    };
+    return aoc::parallelReduce(orderings.size(), k_MinChunkSize, 0,
+        [&](std::size_t begin, std::size_t end) {
+            int total = 0;
+            for (std::size_t j = begin; j < end; ++j) {
+                std::vector<int>& ordering = orderings[j];
+                if (!isOrdered(rules, ordering)) {
+                    // Only the middle page is summed, so only it is put in
+                    // place.
+                    const auto middle = ordering.begin() +
+                                        ordering.size() / 2;
+                    std::nth_element(ordering.begin(), middle, ordering.end(),
+                                     precedes);
+                    total += *middle;
                 }
             }
-        }
-    }
-    std::vector<int> ordered;
-    while (!roots.empty()) {
-        assert(roots.size() == 1);
-        const int num = *roots.begin();
-        roots.erase(roots.begin());
-        ordered.push_back(num);
-        if (auto foundNext = graph.find(num); foundNext != graph.end())
-            for (const int next : foundNext->second)
-                if (auto it = ingress.find(next); it != ingress.end())
-                    if (--it->second == 0)
-                        roots.insert(next);
-    }
-    assert(ordering.size() == ordered.size());
-    ordering = std::move(ordered);
+            return total;
+        });
 }
 
-int main()
+int main(int argc, char *argv[])
 {
-    auto [edges, orderings] = getInput();
-    std::unordered_map<int, std::vector<int>> graph;
-    for (const auto [prev, next] : edges)
-        graph[prev].emplace_back(next);
-
-    int total = 0;
-    for (auto& ordering : orderings) {
-        if (!isOrdered(graph, ordering)) {
-            order(ordering, graph);
-            total += *std::midpoint(ordering.data(),
-                                    ordering.data() + ordering.size());
-        }
-    }
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& input) { return solve(input.first, input.second); });
 }
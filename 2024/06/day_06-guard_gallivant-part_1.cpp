@@ -1,7 +1,7 @@
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <charconv>
-#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -11,17 +11,19 @@
 #include <vector>
 #include <bitset>
 
-std::vector<std::string> getInput()
-{
-    std::vector<std::string> grid;
-    for (std::ifstream input("day_06-guard_gallivant-input.txt");
-         std::getline(input, grid.emplace_back()); )
-        continue;
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
 
-    if (!grid.empty())
-        grid.pop_back();
+// Cells beyond the edge of the map read as 'k_Outside'.
+constexpr char k_Outside = '\0';
 
-    return grid;
+aoc::Grid<char> getInput()
+{
+    const aoc::MappedFile file("day_06-guard_gallivant-input.txt");
+    return aoc::Grid<char>::fromRows(aoc::lines(file.view()), k_Outside);
 }
 
 enum Dir {
@@ -32,15 +34,10 @@ enum Dir {
     e_NumDirs
 };
 
-// 0 1 2 3 4
-// 1
-// 2 ^
-// 3
-
-std::pair<int, int> step(int x, int y, int dir)
+// Offsets of one step in each 'Dir'.
+std::array<Index, e_NumDirs> steps(const aoc::GridShape& grid)
 {
-    constexpr int k_Step[] = { 0, 1, 0, -1, 0 };
-    return std::make_pair(x + k_Step[dir], y - k_Step[dir+1]);
+    return { -grid.stride(), +1, +grid.stride(), -1 };
 }
 
 int turn(int dir)
@@ -50,45 +47,36 @@ int turn(int dir)
 
 typedef std::bitset<e_NumDirs> DirSet;
 
-int main()
+int solve(const aoc::Grid<char>& grid)
 {
-    const std::vector<std::string> grid = getInput();
-    const int k_NumRows = grid.size(),
-              k_NumCols = grid.empty() ? 0 : grid[0].size();
-    int x = -1, y = -1, dir = e_Up;
-    for (int i = 0; i < k_NumRows; ++i) {
-        for (int j = 0; j < k_NumCols; ++j) {
-            if (grid[i][j] == '^') {
-                y = i;
-                x = j;
-                goto found;
-            }
-        }
-    }
-found:
-    assert(x >= 0);
-    assert(y >= 0);
-    std::vector<std::vector<DirSet>> visited(k_NumRows,
-                                             std::vector<DirSet>(k_NumCols));
-    while (true) {
-        assert(!visited[y][x].test(dir));
-        visited[y][x].set(dir);
-        const auto [nextX, nextY] = step(x, y, dir);
-        if ((nextX < 0) || (nextX >= k_NumRows) ||
-            (nextY < 0) || (nextY >= k_NumCols))
+    Index position = grid.find('^');
+    assert(position >= 0);
+    const auto k_Step = steps(grid);
+    aoc::Grid<DirSet> visited(grid, DirSet(), DirSet());
+    for (int dir = e_Up; ; ) {
+        assert(!visited[position].test(dir));
+        visited[position].set(dir);
+        const Index next = position + k_Step[dir];
+        if (grid[next] == k_Outside)
             break;
 
-        if (grid[nextY][nextX] == '#')
+        if (grid[next] == '#')
             dir = turn(dir);
         else
-            x = nextX, y = nextY;
+            position = next;
     }
 
     int total = 0;
-    for (int i = 0; i < k_NumRows; ++i)
-        for (int j = 0; j < k_NumCols; ++j)
-            total += visited[i][j].any();
+    for (Index i = 0; i < grid.numRows(); ++i)
+        for (const DirSet& cell : visited.rowCells(i))
+            total += cell.any();
+
+    return total;
+}
 
-    std::cout << total << std::endl;
-    return 0;
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
@@ -1,27 +1,24 @@
 #include <algorithm>
+#include <array>
 #include <cassert>
-#include <charconv>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
-#include <numeric>
-#include <string>
-#include <unordered_map>
-#include <utility>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
-#include <bitset>
 
-std::vector<std::string> getInput()
-{
-    std::vector<std::string> grid;
-    for (std::ifstream input("day_06-guard_gallivant-input.txt");
-         std::getline(input, grid.emplace_back()); )
-        continue;
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/thread_pool.h>
+
+using Index = aoc::GridShape::Index;
 
-    if (!grid.empty())
-        grid.pop_back();
+// Cells beyond the edge of the map read as 'k_Outside'.
+constexpr char k_Outside = '\0';
 
-    return grid;
+aoc::Grid<char> getInput()
+{
+    const aoc::MappedFile file("day_06-guard_gallivant-input.txt");
+    return aoc::Grid<char>::fromRows(aoc::lines(file.view()), k_Outside);
 }
 
 enum Dir {
@@ -32,15 +29,10 @@ enum Dir {
     e_NumDirs
 };
 
-// 0 1 2 3 4
-// 1
-// 2 ^
-// 3
-
-std::pair<int, int> step(int x, int y, int dir)
+// Offsets of one step in each 'Dir'.
+std::array<Index, e_NumDirs> steps(const aoc::GridShape& grid)
 {
-    constexpr int k_Step[] = { 0, 1, 0, -1, 0 };
-    return std::make_pair(x + k_Step[dir], y - k_Step[dir+1]);
+    return { -grid.stride(), +1, +grid.stride(), -1 };
 }
 
 int turn(int dir)
@@ -48,65 +40,157 @@ int turn(int dir)
     return (dir + 1) % 4;
 }
 
-typedef std::bitset<e_NumDirs> DirSet;
+// Where the guard stops when walking from a cell in one direction: the last
+// cell before the next obstacle, or 'k_Exit' if she walks off the map.
+typedef std::array<aoc::Grid<Index>, e_NumDirs> JumpTable;
+
+constexpr Index k_Exit = -1;
 
-bool haveCycle(const std::vector<std::string>&    grid,
-               std::vector<std::vector<DirSet>>& visited,
-               int x, int y)
+JumpTable makeJumpTable(const aoc::Grid<char>& grid)
 {
-    const int k_NumRows = grid.size(),
-              k_NumCols = grid.empty() ? 0 : grid[0].size();
-
-    for (auto& row : visited)
-        for (auto& cell : row)
-            cell.reset();
-
-    for (int dir = e_Up; !visited[y][x].test(dir); ) {
-        visited[y][x].set(dir);
-        const auto [nextX, nextY] = step(x, y, dir);
-        if ((nextX < 0) || (nextX >= k_NumRows) ||
-            (nextY < 0) || (nextY >= k_NumCols))
-            return false;
+    const auto k_Step = steps(grid);
+    JumpTable  jumps;
+    for (int dir = e_Up; dir < e_NumDirs; ++dir) {
+        aoc::Grid<Index>& jump = jumps[dir];
+        jump = aoc::Grid<Index>(grid, k_Exit, k_Exit);
 
-        if (grid[nextY][nextX] == '#')
-            dir = turn(dir);
-        else
-            x = nextX, y = nextY;
+        // Visit each cell after the one it steps to.
+        const Index step = k_Step[dir];
+        for (Index n = 0; n < grid.size(); ++n) {
+            const Index cell = step < 0 ? n : grid.size() - 1 - n;
+            if (grid[cell] == k_Outside || grid[cell] == '#')
+                continue;
+            const char next = grid[cell + step];
+            jump[cell] = next == '#'       ? cell
+                       : next == k_Outside ? k_Exit
+                       :                     jump[cell + step];
+        }
     }
-    return true;
+    return jumps;
 }
 
-int main()
+// Return how far along 'dir' the cell at 'row' and 'col' is.
+Index progress(int dir, Index row, Index col)
 {
-    std::vector<std::string> grid = getInput();
-    const int k_NumRows = grid.size(),
-              k_NumCols = grid.empty() ? 0 : grid[0].size();
-    int x = -1, y = -1;
-    for (int i = 0; i < k_NumRows; ++i) {
-        for (int j = 0; j < k_NumCols; ++j) {
-            if (grid[i][j] == '^') {
-                y = i;
-                x = j;
-                goto found;
-            }
+    switch (dir) {
+      case e_Up:    return -row;
+      case e_Right: return  col;
+      case e_Down:  return  row;
+      default:      return -col;
+    }
+}
+
+// Return whether the guard walks in a loop from 'position' once an obstacle
+// is added at 'obstacle'.  She moves from one stop to the next through
+// 'jumps', cut short where the new obstacle lies in between.  The stops are
+// recorded in 'stops' as 'generation', which must differ from any value it
+// already holds, so that it needs no clearing between calls.
+bool haveCycle(const aoc::Grid<char>&      grid,
+               const JumpTable&            jumps,
+               Index                       position,
+               Index                       obstacle,
+               std::vector<std::uint32_t>& stops,
+               std::uint32_t               generation)
+{
+    const auto  k_Step      = steps(grid);
+    const Index obstacleRow = grid.row(obstacle),
+                obstacleCol = grid.col(obstacle);
+    for (int dir = e_Up; ; dir = turn(dir)) {
+        Index       stop = jumps[dir][position];
+        const Index row  = grid.row(position), col = grid.col(position);
+        const bool  isVertical = dir == e_Up || dir == e_Down;
+        if ((isVertical ? col == obstacleCol : row == obstacleRow) &&
+            progress(dir, obstacleRow, obstacleCol) > progress(dir, row, col) &&
+            (stop == k_Exit ||
+             progress(dir, obstacleRow, obstacleCol) <=
+                          progress(dir, grid.row(stop), grid.col(stop))))
+            stop = obstacle - k_Step[dir];
+        if (stop == k_Exit)
+            return false;
+
+        std::uint32_t& seen = stops[stop * e_NumDirs + dir];
+        if (seen == generation)
+            return true;
+        seen     = generation;
+        position = stop;
+    }
+}
+
+// The stops recorded by the walks of one thread (see 'haveCycle').
+struct Walks {
+    std::vector<std::uint32_t> d_stops;
+    std::uint32_t              d_generation = 0;
+
+    // Make room for 'size' stops, forgetting them if that changes the size.
+    void reset(std::size_t size)
+    {
+        if (d_stops.size() != size) {
+            d_stops.assign(size, 0);
+            d_generation = 0;
         }
     }
-found:
-    assert(x >= 0);
-    assert(y >= 0);
-    std::vector<std::vector<DirSet>> visited(k_NumRows,
-                                             std::vector<DirSet>(k_NumCols));
-
-    int total = 0;
-    for (int i = 0; i < k_NumRows; ++i) {
-        for (int j = 0; j < k_NumCols; ++j) {
-            if (grid[i][j] == '.') {
-                grid[i][j] = '#';
-                total += haveCycle(grid, visited, x, y);
-                grid[i][j] = '.';
-            }
+
+    // Return a generation that no stop has yet, clearing them all on
+    // wrap-around.
+    std::uint32_t nextGeneration()
+    {
+        if (++d_generation == 0) {
+            std::ranges::fill(d_stops, 0);
+            d_generation = 1;
         }
+        return d_generation;
     }
-    std::cout << total << std::endl;
-    return 0;
+};
+
+// Fewest candidate obstacles worth handing to a thread of the pool.
+constexpr std::size_t k_MinChunkSize = 256;
+
+int solve(const aoc::Grid<char>& grid)
+{
+    const Index start = grid.find('^');
+    assert(start >= 0);
+    const auto      k_Step = steps(grid);
+    const JumpTable jumps  = makeJumpTable(grid);
+
+    // An obstacle off the guard's route does not change it, so only the
+    // cells she visits are worth trying.
+    std::vector<Index>        route;
+    aoc::Grid<std::uint8_t>   onRoute(grid, 0, 0);
+    Index position = start;
+    for (int dir = e_Up; ; ) {
+        if (!onRoute[position] && position != start) {
+            onRoute[position] = 1;
+            route.push_back(position);
+        }
+        const Index next = position + k_Step[dir];
+        if (grid[next] == k_Outside)
+            break;
+
+        if (grid[next] == '#')
+            dir = turn(dir);
+        else
+            position = next;
+    }
+
+    // Each thread keeps the stops of its own walks, which are all on the
+    // same map as the grid is never changed, and the chunks of the route
+    // are spread over (and stolen between) the threads of the pool.
+    return aoc::parallelReduce(route.size(), k_MinChunkSize, 0,
+        [&](std::size_t begin, std::size_t end) {
+            thread_local Walks walks;
+            walks.reset(grid.size() * e_NumDirs);
+
+            int total = 0;
+            for (std::size_t j = begin; j < end; ++j)
+                total += haveCycle(grid, jumps, start, route[j],
+                                   walks.d_stops, walks.nextGeneration());
+            return total;
+        });
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
@@ -1,32 +1,48 @@
 #include <algorithm>
 #include <cassert>
 #include <charconv>
+#include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
+#include <memory_resource>
 #include <numeric>
 #include <stack>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/arena.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+// Parse the equation 'line': store its test value in 'result' and append its
+// numbers to 'operands'.
+void parseEquation(std::string_view            line,
+                   std::uint64_t&              result,
+                   std::vector<std::uint64_t>& operands)
+{
+    const char *c = line.data(), *const cEnd = c + line.size();
+    auto res = std::from_chars(c, cEnd, result);
+    assert(res.ec == std::errc());
+    assert(c < cEnd);
+    for (c = res.ptr + 2;
+         res = std::from_chars(c, cEnd, operands.emplace_back()),
+         res.ptr != cEnd; c = res.ptr + 1) {
+        assert(res.ec == std::errc());
+        continue;
+    }
+    assert(res.ec == std::errc());
+}
+
 auto getInput()
 {
     std::vector<std::pair<std::uint64_t, std::vector<std::uint64_t>>> equations;
-    std::ifstream stream("day_07-bridge_repair-input.txt");
-    for (std::string line; std::getline(stream, line); ) {
-        const char *c = line.c_str(), *const cEnd = c + line.size();
+    const aoc::MappedFile file("day_07-bridge_repair-input.txt");
+    for (const std::string_view line : aoc::lines(file.view())) {
         auto& [result, operands] = equations.emplace_back();
-        auto res = std::from_chars(c, cEnd, result);
-        assert(res.ec == std::errc());
-        assert(c < cEnd);
-        for (c = res.ptr + 2;
-             res = std::from_chars(c, cEnd, operands.emplace_back()),
-             res.ptr != cEnd; c = res.ptr + 1) {
-            assert(res.ec == std::errc());
-            continue;
-        }
-        assert(res.ec == std::errc());
+        parseEquation(line, result, operands);
     }
     assert(!equations.empty());
     return equations;
@@ -36,9 +52,21 @@ bool canSatisfy(std::uint64_t result, const std::vector<std::uint64_t>& operands
 {
     assert(!operands.empty());
 
-    std::vector<std::uint64_t> prev, next;
+    // Both generations live in this thread's arena, sized up front for the
+    // largest level each will hold, so that no equation touches the heap:
+    // they swap roles every level, so one holds the last level and the other
+    // the level before it, half the size.
+    aoc::ArenaScope scratch;
+    std::size_t     maxSize = 1;
+    for (std::size_t i = 1; i < operands.size(); ++i)
+        maxSize *= 2;
+    std::pmr::vector<std::uint64_t> prev(scratch.resource()),
+                                    next(scratch.resource());
+    const bool lastInPrev = (operands.size() - 1) % 2 == 1;
+    (lastInPrev ? prev : next).reserve(maxSize);
+    (lastInPrev ? next : prev).reserve(maxSize / 2);
     next.push_back(operands[0]);
-    for (int i = 1; i < operands.size(); ++i) {
+    for (int i = 1; i < std::ssize(operands); ++i) {
         std::swap(prev, next);
         next.clear();
         for (const auto prevSum : prev) {
@@ -49,13 +77,42 @@ bool canSatisfy(std::uint64_t result, const std::vector<std::uint64_t>& operands
     return std::find(next.begin(), next.end(), result) != next.end();
 }
 
-int main()
+std::uint64_t solve(
+   const std::vector<std::pair<std::uint64_t, std::vector<std::uint64_t>>>& equations)
 {
     std::uint64_t total = 0;
-    for (const auto& [result, operations] : getInput())
+    for (const auto& [result, operations] : equations)
         if (canSatisfy(result, operations))
             total += result;
 
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+// Sum the results of the satisfiable equations among 'lines' as they are
+// read.
+template <class LINES>
+std::uint64_t solveStreaming(LINES&& lines)
+{
+    std::uint64_t              total = 0;
+    std::vector<std::uint64_t> operands;
+    for (const std::string_view line : lines) {
+        std::uint64_t result = 0;
+        operands.clear();
+        parseEquation(line, result, operands);
+        if (canSatisfy(result, operands))
+            total += result;
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& equations) { return solve(equations); },
+        [] {
+            return solveStreaming(
+                          aoc::LineReader("day_07-bridge_repair-input.txt"));
+        });
 }
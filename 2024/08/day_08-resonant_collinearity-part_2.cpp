@@ -1,7 +1,6 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
@@ -10,15 +9,15 @@
 #include <utility>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream stream("day_08-resonant_collinearity-input.txt");
-         std::getline(stream, grid.emplace_back()); )
-        continue;
-
+    const aoc::MappedFile file("day_08-resonant_collinearity-input.txt");
+    const auto rows = aoc::lines(file.view());
+    std::vector<std::string> grid(rows.begin(), rows.end());
     assert(!grid.empty());
-    grid.pop_back();
     return grid;
 }
 
@@ -43,9 +42,8 @@ void placePoles(std::vector<std::vector<bool>>& poles,
         poles[i][j] = true;
 }
 
-int main()
+int solve(const std::vector<std::string>& grid)
 {
-    const auto grid = getInput();
     const int k_NumRows = grid.size(),
               k_NumCols = grid.empty() ? 0 : grid[0].size();
     std::array<std::vector<std::pair<int, int>>,
@@ -58,16 +56,20 @@ int main()
     std::vector<std::vector<bool>> poles(k_NumRows,
                                          std::vector<bool>(k_NumCols));
     for (const auto& ants : antennas)
-        for (int i = 0; i < ants.size(); ++i)
-            for (int j = i+1; j < ants.size(); ++j)
+        for (int i = 0; i < std::ssize(ants); ++i)
+            for (int j = i+1; j < std::ssize(ants); ++j)
                 placePoles(poles, ants[i], ants[j]);
 
-    std::cout <<
-        std::transform_reduce(poles.begin(), poles.end(), 0, std::plus{},
-                                [](const auto& row)
-                                {
-                                    return std::count(row.begin(), row.end(), true);
-                                })
-        << std::endl;
-    return 0;
+    return std::transform_reduce(poles.begin(), poles.end(), 0, std::plus{},
+                                 [](const auto& row)
+                                 {
+                                     return std::count(row.begin(), row.end(), true);
+                                 });
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
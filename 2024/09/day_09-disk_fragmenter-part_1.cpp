@@ -1,24 +1,25 @@
 #include <cassert>
 #include <algorithm>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <string>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
-    std::string   line;
-    std::ifstream stream("day_09-disk_fragmenter-input.txt");
-    std::getline(stream, line);
-    assert(stream);
+    const aoc::MappedFile file("day_09-disk_fragmenter-input.txt");
+    const auto            lines = aoc::lines(file.view());
+    assert(lines.begin() != lines.end());
+    std::string line(*lines.begin());
     assert(!line.empty());
     return line;
 }
 
-int main()
+std::uint64_t solve(std::string& line)
 {
     std::uint64_t checkSum = 0, pos = 0;
-    std::string line = getInput();
     for (std::uint64_t l = 0, r = line.size()-1; ; l += 2) {
         for (std::uint64_t lRem = line[l]-'0', lId = l / 2; lRem > 0; --lRem)
             checkSum += lId * pos++;
@@ -40,6 +41,12 @@ int main()
                 checkSum += rId * pos++;
         }
     }
-    std::cout << checkSum << std::endl;
-    return 0;
+    return checkSum;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& line) { return solve(line); });
 }
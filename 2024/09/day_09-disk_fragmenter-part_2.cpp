@@ -2,29 +2,30 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <set>
 #include <string>
 #include <tuple>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
-    std::string   line;
-    std::ifstream stream("day_09-disk_fragmenter-input.txt");
-    std::getline(stream, line);
-    assert(stream);
+    const aoc::MappedFile file("day_09-disk_fragmenter-input.txt");
+    const auto            lines = aoc::lines(file.view());
+    assert(lines.begin() != lines.end());
+    std::string line(*lines.begin());
     assert(!line.empty());
     return line;
 }
 
-int main()
+std::uint64_t solve(std::string& line)
 {
     // [size] = { p1, p2, ... }
-    std::string line = getInput();
     std::array<std::set<std::int64_t>, 10> holes;
-    for (std::int64_t h = 1; h < line.size(); h += 2)
+    for (std::int64_t h = 1; h < std::ssize(line); h += 2)
         if (const std::int64_t hSize = line[h]-'0'; hSize > 0)
             holes[hSize].emplace(h);
 
@@ -35,7 +36,7 @@ int main()
             continue;
 
         std::int64_t h = f, hSize = -1;
-        for (std::int64_t size = fSize; size < holes.size(); ++size) {
+        for (std::int64_t size = fSize; size < std::ssize(holes); ++size) {
             if (!holes[size].empty()) {
                 if (*holes[size].begin() < h) {
                     h     = *holes[size].begin();
@@ -55,7 +56,7 @@ int main()
         }
         holes[fSize].emplace(f);
     }
-    for (std::int64_t hSize = 1; hSize < holes.size(); ++hSize)
+    for (std::int64_t hSize = 1; hSize < std::ssize(holes); ++hSize)
         for (const std::int64_t h : holes[hSize])
             files.emplace_back(h, -1, hSize);
 
@@ -63,13 +64,19 @@ int main()
                          return std::get<0>(lhs) < std::get<0>(rhs);
                      });
     std::uint64_t checkSum = 0, pos = 0;
-    for (const auto [_, id, size] : files) {
+    for (const auto& [_, id, size] : files) {
         if (id >= 0)
-            for (std::uint64_t i = 0; i < size; ++i)
+            for (std::uint64_t i = 0; i < std::uint64_t(size); ++i)
                 checkSum += (pos + i) * id;
 
         pos += size;
     }
-    std::cout << checkSum << std::endl;
-    return 0;
+    return checkSum;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& line) { return solve(line); });
 }
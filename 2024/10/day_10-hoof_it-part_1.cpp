@@ -1,22 +1,20 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream stream("day_10-hoof_it-input.txt");
-         std::getline(stream, grid.emplace_back()); )
-        continue;
-
-    assert(!grid.empty());
-    grid.pop_back();
+    const aoc::MappedFile file("day_10-hoof_it-input.txt");
+    const auto rows = aoc::lines(file.view());
+    std::vector<std::string> grid(rows.begin(), rows.end());
     assert(!grid.empty());
     return grid;
 }
@@ -41,8 +39,8 @@ score(std::vector<std::vector<bool>>&                             visited,
     constexpr int k_Dir[] = { 0, +1, 0, -1, 0 };
     for (int k = 0; k < 4; ++k) {
         if (const int nI = i+k_Dir[k], nJ = j+k_Dir[k+1];
-            (nI >= 0) && (nI < grid.size()) &&
-            (nJ >= 0) && (nJ < grid[nI].size()) &&
+            (nI >= 0) && (nI < std::ssize(grid)) &&
+            (nJ >= 0) && (nJ < std::ssize(grid[nI])) &&
             (grid[nI][nJ] == (grid[i][j]+1))) {
             const auto& nextPeaks = score(visited, peaks, grid, nI, nJ);
             std::swap(currPeaks, prevPeaks);
@@ -57,9 +55,8 @@ score(std::vector<std::vector<bool>>&                             visited,
     return currPeaks;
 }
 
-int main()
+std::int64_t solve(const std::vector<std::string>& grid)
 {
-    std::vector<std::string> grid = getInput();
     const int k_NumRows = grid.size(), k_NumCols = grid.empty() ? 0 : grid[0].size();
     std::vector<std::vector<std::vector<std::pair<int, int>>>> peaks(
                      k_NumRows,
@@ -72,6 +69,12 @@ int main()
             if (grid[i][j] == '0')
                 total += score(visited, peaks, grid, i, j).size();
 
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
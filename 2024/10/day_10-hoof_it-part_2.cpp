@@ -1,19 +1,17 @@
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream stream("day_10-hoof_it-input.txt");
-         std::getline(stream, grid.emplace_back()); )
-        continue;
-
-    assert(!grid.empty());
-    grid.pop_back();
+    const aoc::MappedFile file("day_10-hoof_it-input.txt");
+    const auto rows = aoc::lines(file.view());
+    std::vector<std::string> grid(rows.begin(), rows.end());
     assert(!grid.empty());
     return grid;
 }
@@ -35,8 +33,8 @@ std::int64_t score(std::vector<std::vector<std::int64_t>>& numPaths,
     constexpr int k_Dir[] = { 0, +1, 0, -1, 0 };
     for (int k = 0; k < 4; ++k)
         if (const int nI = i+k_Dir[k], nJ = j+k_Dir[k+1];
-            (nI >= 0) && (nI < grid.size()) &&
-            (nJ >= 0) && (nJ < grid[nI].size()) &&
+            (nI >= 0) && (nI < std::ssize(grid)) &&
+            (nJ >= 0) && (nJ < std::ssize(grid[nI])) &&
             (grid[nI][nJ] == (height + 1)))
             total += score(numPaths, grid, nI, nJ);
 
@@ -44,9 +42,8 @@ std::int64_t score(std::vector<std::vector<std::int64_t>>& numPaths,
     return total;
 }
 
-int main()
+std::int64_t solve(const std::vector<std::string>& grid)
 {
-    std::vector<std::string> grid = getInput();
     const int k_NumRows = grid.size(), k_NumCols = grid.empty() ? 0 : grid[0].size();
     std::vector<std::vector<std::int64_t>> numPaths(
                                       k_NumRows,
@@ -57,6 +54,12 @@ int main()
             if (grid[i][j] == '0')
                 total += score(numPaths, grid, i, j);
 
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
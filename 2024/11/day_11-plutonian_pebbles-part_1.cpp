@@ -1,28 +1,37 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
+#include <spanstream>
 #include <utility>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
     std::vector<std::uint64_t> stones;
-    std::ifstream stream("day_11-plutonian_pebbles-input.txt");
+    const aoc::MappedFile file("day_11-plutonian_pebbles-input.txt");
+    std::ispanstream stream(file.bytes());
     const std::istream_iterator<std::uint64_t> sBegin(stream), sEnd;
     std::copy(sBegin, sEnd, std::back_inserter(stones));
     return stones;
 }
 
-std::vector<std::uint64_t> makeMags()
+// Return the powers of ten that fit in 'std::uint64_t'.  They depend on no
+// input, so they are built once and shared by every input solved.
+const std::vector<std::uint64_t>& makeMags()
 {
-    std::vector<std::uint64_t> mags;
-    for (std::uint64_t pMag = 0, mag = 1; mag > pMag; pMag = mag, mag *= 10)
-        mags.push_back(mag);
-
-    return mags;
+    static const std::vector<std::uint64_t> s_mags = [] {
+        std::vector<std::uint64_t> mags;
+        for (std::uint64_t pMag = 0, mag = 1; mag > pMag;
+             pMag = mag, mag *= 10)
+            mags.push_back(mag);
+        return mags;
+    }();
+    return s_mags;
 }
 
 std::uint64_t numDigits(const std::vector<std::uint64_t>& mags,
@@ -41,9 +50,10 @@ std::uint64_t magForDigits(const std::vector<std::uint64_t>& mags,
     return mags[numDigits-1];
 }
 
-int main()
+std::size_t solve(std::vector<std::uint64_t> stones)
 {
-    std::vector<std::uint64_t> stones = getInput(), pStones, mags = makeMags();
+    const std::vector<std::uint64_t>& mags = makeMags();
+    std::vector<std::uint64_t>        pStones;
     for (int remIterations = 25; remIterations > 0; --remIterations) {
         std::swap(stones, pStones);
         stones.clear();
@@ -64,6 +74,12 @@ int main()
             }
         }
     }
-    std::cout << stones.size() << std::endl;
-    return 0;
+    return stones.size();
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& stones) { return solve(stones); });
 }
@@ -1,29 +1,38 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
+#include <spanstream>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput()
 {
     std::vector<std::uint64_t> stones;
-    std::ifstream stream("day_11-plutonian_pebbles-input.txt");
+    const aoc::MappedFile file("day_11-plutonian_pebbles-input.txt");
+    std::ispanstream stream(file.bytes());
     const std::istream_iterator<std::uint64_t> sBegin(stream), sEnd;
     std::copy(sBegin, sEnd, std::back_inserter(stones));
     return stones;
 }
 
-std::vector<std::uint64_t> makeMags()
+// Return the powers of ten that fit in 'std::uint64_t'.  They depend on no
+// input, so they are built once and shared by every input solved.
+const std::vector<std::uint64_t>& makeMags()
 {
-    std::vector<std::uint64_t> mags;
-    for (std::uint64_t pMag = 0, mag = 1; mag > pMag; pMag = mag, mag *= 10)
-        mags.push_back(mag);
-
-    return mags;
+    static const std::vector<std::uint64_t> s_mags = [] {
+        std::vector<std::uint64_t> mags;
+        for (std::uint64_t pMag = 0, mag = 1; mag > pMag;
+             pMag = mag, mag *= 10)
+            mags.push_back(mag);
+        return mags;
+    }();
+    return s_mags;
 }
 
 std::uint64_t numDigits(const std::vector<std::uint64_t>& mags,
@@ -42,18 +51,18 @@ std::uint64_t magForDigits(const std::vector<std::uint64_t>& mags,
     return mags[numDigits-1];
 }
 
-int main()
+std::uint64_t solve(const std::vector<std::uint64_t>& stones)
 {
-    std::vector<std::uint64_t> mags = makeMags();
+    const std::vector<std::uint64_t>& mags = makeMags();
     std::unordered_map<std::uint64_t, std::uint64_t> counts, pCounts;
-    for (const std::uint64_t stone : getInput())
+    for (const std::uint64_t stone : stones)
         ++counts[stone];
 
     for (int remIterations = 75; remIterations > 0; --remIterations) {
         std::swap(counts, pCounts);
         counts.clear();
         // 0 => 1 => 2024 => 20, 24 => 2, 0, 2, 4
-        for (const auto [pStone, pCount] : pCounts) {
+        for (const auto& [pStone, pCount] : pCounts) {
             if (pStone == 0) {
                 counts[1] += pCount;
             }
@@ -71,9 +80,15 @@ int main()
         }
     }
     std::uint64_t total = 0;
-    for (const auto [_, count] : counts)
+    for (const auto& [_, count] : counts)
         total += count;
 
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& stones) { return solve(stones); });
 }
@@ -1,44 +1,39 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
+
 auto getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream stream("day_12-garden_groups-input.txt");
-         std::getline(stream, grid.emplace_back()); )
-        continue;
-
-    assert(!grid.empty());
-    grid.pop_back();
-    assert(!grid.empty());
+    const aoc::MappedFile file("day_12-garden_groups-input.txt");
+    const auto grid = aoc::Grid<char>::fromRows(aoc::lines(file.view()), '\0');
+    assert(grid.numRows() > 0);
     return grid;
 }
 
-void visitGarden(std::uint64_t&                  area,
-                 std::uint64_t&                  perimeter,
-                 std::vector<std::vector<int>>&  gardens,
-                 int                             garden,
-                 const std::vector<std::string>& grid,
-                 int                             i,
-                 int                             j)
+void visitGarden(std::uint64_t&         area,
+                 std::uint64_t&         perimeter,
+                 aoc::Grid<int>&        gardens,
+                 int                    garden,
+                 const aoc::Grid<char>& grid,
+                 Index                  index)
 {
-    gardens[i][j] = garden;
+    gardens[index] = garden;
     ++area;
-    constexpr int k_Dir[] = { 0, +1, 0, -1, 0 };
-    const int m = grid.size(), n = grid[0].size();
-    for (int k = 0; k < 4; ++k) {
-        if (const int nI = i+k_Dir[k], nJ = j+k_Dir[k+1];
-            (nI >= 0) && (nI < m) &&
-            (nJ >= 0) && (nJ < n) &&
-            (grid[nI][nJ] == grid[i][j])) {
-            if (gardens[nI][nJ] < 0)
-                visitGarden(area, perimeter, gardens, garden, grid, nI, nJ);
+    for (const Index offset : grid.neighbors()) {
+        if (const Index next = index + offset; grid[next] == grid[index]) {
+            if (gardens[next] < 0)
+                visitGarden(area, perimeter, gardens, garden, grid, next);
         }
         else {
             ++perimeter;
@@ -46,21 +41,25 @@ void visitGarden(std::uint64_t&                  area,
     }
 }
 
-int main()
+std::uint64_t solve(const aoc::Grid<char>& grid)
 {
-    const std::vector<std::string> grid = getInput();
-    const int m = grid.size(), n = grid[0].size();
-    std::vector<std::vector<int>> gardens(m, std::vector<int>(n, -1));
+    aoc::Grid<int> gardens(grid, -1, -1);
     std::uint64_t total = 0;
-    for (int i = 0, garden = 0; i < m; ++i) {
-        for (int j = 0; j < n; ++j) {
-            if (gardens[i][j] < 0) {
+    for (Index i = 0, garden = 0; i < grid.numRows(); ++i) {
+        for (Index j = 0; j < grid.numCols(); ++j) {
+            if (const Index index = grid.index(i, j); gardens[index] < 0) {
                 std::uint64_t area = 0, perimeter = 0;
-                visitGarden(area, perimeter, gardens, garden++, grid, i, j);
+                visitGarden(area, perimeter, gardens, garden++, grid, index);
                 total += (area * perimeter);
             }
         }
     }
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
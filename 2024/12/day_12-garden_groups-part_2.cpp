@@ -1,52 +1,45 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <unordered_map>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
+
 auto getInput()
 {
-    std::vector<std::string> grid;
-    for (std::ifstream stream("day_12-garden_groups-input.txt");
-         std::getline(stream, grid.emplace_back()); )
-        continue;
-
-    assert(!grid.empty());
-    grid.pop_back();
-    assert(!grid.empty());
+    const aoc::MappedFile file("day_12-garden_groups-input.txt");
+    const auto grid = aoc::Grid<char>::fromRows(aoc::lines(file.view()), '\0');
+    assert(grid.numRows() > 0);
     return grid;
 }
 // | X | Y - Y |
 // +   |   +---+
 // | X | Y | Z |
 //
-constexpr int k_Dir[] = { 0, +1, 0, -1, 0 };
-
-void visitGarden(std::uint64_t&                  area,
-                 std::uint64_t&                  numCorners,
-                 std::vector<std::vector<bool>>& visited,
-                 const std::vector<std::string>& grid,
-                 int                             i,
-                 int                             j)
+void visitGarden(std::uint64_t&         area,
+                 std::uint64_t&         numCorners,
+                 aoc::BitGrid&          visited,
+                 const aoc::Grid<char>& grid,
+                 Index                  index)
 {
-    visited[i][j] = true;
+    visited.set(index);
     ++area;
-    const int m = grid.size(), n = grid[0].size();
-    const auto isMatch = [&](int nI, int nJ) {
-        return (nI >= 0) && (nI < m) &&
-               (nJ >= 0) && (nJ < n) &&
-               (grid[nI][nJ] == grid[i][j]);
-    };
+    const auto k_Dir = grid.neighbors();
     bool haveObs[5] = { false }, haveMatch[5] = { false };
     for (int d = 0; d < 4; ++d) {
-        if (const int nI = i+k_Dir[d], nJ = j+k_Dir[d+1]; isMatch(nI, nJ)) {
+        if (const Index next = index + k_Dir[d]; grid[next] == grid[index]) {
             haveMatch[d] = true;
-            if (!visited[nI][nJ])
-                visitGarden(area, numCorners, visited, grid, nI, nJ);
+            if (!visited.test(next))
+                visitGarden(area, numCorners, visited, grid, next);
         }
         else {
             haveObs[d] = true;
@@ -57,10 +50,8 @@ void visitGarden(std::uint64_t&                  area,
     for (int d = 0; d < 4; ++d) {
         numCorners += (haveObs[d] & haveObs[d+1]);
         if (haveMatch[d] && haveMatch[d+1]) {
-            const int dX = (d <= 1) ? +1 : -1,
-                      dY = ((d == 0) || (d == 3)) ? +1 : -1;
-            const int dI = i + dX, dJ = j + dY;
-            numCorners += !isMatch(dI, dJ);
+            const Index diagonal = index + k_Dir[d] + k_Dir[(d+1) % 4];
+            numCorners += (grid[diagonal] != grid[index]);
         }
     }
 }
@@ -105,22 +96,26 @@ void visitGarden(std::uint64_t&                  area,
 // |   2--2
 // 2------2
 
-int main()
+std::uint64_t solve(const aoc::Grid<char>& grid)
 {
-    const std::vector<std::string> grid = getInput();
-    const int m = grid.size(), n = grid[0].size();
-    std::vector<std::vector<bool>> visited(m, std::vector<bool>(n));
+    aoc::BitGrid visited(grid);
     std::uint64_t total = 0;
-    for (int i = 0; i < m; ++i) {
-        for (int j = 0; j < n; ++j) {
-            if (!visited[i][j]) {
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        for (Index j = 0; j < grid.numCols(); ++j) {
+            if (const Index index = grid.index(i, j); !visited.test(index)) {
                 std::uint64_t area = 0, numCorners = 0;
-                visitGarden(area, numCorners, visited, grid, i, j);
+                visitGarden(area, numCorners, visited, grid, index);
                 const auto numSides = numCorners;
                 total += (area * numSides);
             }
         }
     }
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid); });
 }
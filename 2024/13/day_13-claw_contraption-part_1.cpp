@@ -2,15 +2,19 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <numeric>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+
 struct Vec2 {
     std::int64_t d_x, d_y;
 };
@@ -19,45 +23,31 @@ struct Machine {
     Vec2 d_a, d_b, d_prize;
 };
 
-auto getInput(std::istream& stream)
+auto getInput(std::string_view input)
 {
     std::vector<Machine> machines;
-    const std::regex buttonMatcher("^Button ([AB]): X\\+(\\d+), Y\\+(\\d+)$"),
-                     prizeMatcher( "^Prize: X=(\\d+), Y=(\\d+)$");
-    while (stream) {
-        machines.emplace_back();
-        std::string line;
-        bool        haveMatch;
-        std::smatch match;
-
-        std::getline(stream, line);
-        assert(stream);
-        haveMatch = std::regex_search(line, match, buttonMatcher);
-        assert(haveMatch);
-        assert(match.size() == 4);
-        assert(match[1] == 'A');
-        machines.back().d_a.d_x = std::stoll(match[2]);
-        machines.back().d_a.d_y = std::stoll(match[3]);
-
-        std::getline(stream, line);
-        assert(stream);
-        haveMatch = std::regex_search(line, match, buttonMatcher);
-        assert(haveMatch);
-        assert(match.size() == 4);
-        assert(match[1] == 'B');
-        machines.back().d_b.d_x = std::stoll(match[2]);
-        machines.back().d_b.d_y = std::stoll(match[3]);
-
-        std::getline(stream, line);
-        assert(stream);
-        haveMatch = std::regex_search(line, match, prizeMatcher);
-        assert(haveMatch);
-        assert(match.size() == 3);
-        machines.back().d_prize.d_x = std::stoll(match[1]);
-        machines.back().d_prize.d_y = std::stoll(match[2]);
-
-        std::getline(stream, line);
-        assert(line.empty());
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); ) {
+        Machine& machine = machines.emplace_back();
+        const bool haveMatch =
+            scanner.consume("Button A: X+") &&
+            scanner.readInt(machine.d_a.d_x) && scanner.consume(", Y+") &&
+            scanner.readInt(machine.d_a.d_y) && scanner.consume('\n') &&
+            scanner.consume("Button B: X+") &&
+            scanner.readInt(machine.d_b.d_x) && scanner.consume(", Y+") &&
+            scanner.readInt(machine.d_b.d_y) && scanner.consume('\n') &&
+            scanner.consume("Prize: X=") &&
+            scanner.readInt(machine.d_prize.d_x) && scanner.consume(", Y=") &&
+            scanner.readInt(machine.d_prize.d_y) &&
+            (scanner.consume('\n') || scanner.atEnd());
+        if (!haveMatch) {
+            // Drop the record and skip the rest of the line that did not
+            // match (e.g. a stray line, or one ending in '\r'), so that the
+            // loop always advances.
+            machines.pop_back();
+            scanner.skipLine();
+            continue;
+        }
+        scanner.consume('\n');
     }
     assert(!machines.empty());
     return machines;
@@ -65,8 +55,36 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_13-claw_contraption-input.txt");
-    return getInput(stream);
+    const aoc::MappedFile file("day_13-claw_contraption-input.txt");
+    return getInput(file.view());
+}
+
+// Parse 'line', one line of a machine's description, into 'machine' and
+// return whether it was the last one (the prize).  Blank lines between
+// machines are ignored.
+bool parseMachineLine(std::string_view line, Machine& machine)
+{
+    aoc::Scanner scanner(line);
+    [[maybe_unused]] bool haveMatch = true;
+    bool isPrize = false;
+    if (scanner.consume("Button A: X+")) {
+        haveMatch = scanner.readInt(machine.d_a.d_x) &&
+                    scanner.consume(", Y+")          &&
+                    scanner.readInt(machine.d_a.d_y);
+    }
+    else if (scanner.consume("Button B: X+")) {
+        haveMatch = scanner.readInt(machine.d_b.d_x) &&
+                    scanner.consume(", Y+")          &&
+                    scanner.readInt(machine.d_b.d_y);
+    }
+    else if (scanner.consume("Prize: X=")) {
+        haveMatch = scanner.readInt(machine.d_prize.d_x) &&
+                    scanner.consume(", Y=")              &&
+                    scanner.readInt(machine.d_prize.d_y);
+        isPrize = true;
+    }
+    assert(haveMatch && scanner.atEnd());
+    return isPrize;
 }
 
 void minCoins(std::uint64_t& numA, std::uint64_t& numB, const Machine& machine)
@@ -148,73 +166,104 @@ void minCoins(std::uint64_t& numA, std::uint64_t& numB, const Machine& machine)
     }
 }
 
-bool check(std::uint64_t      expectedNumA,
+void check(int                lineNumber,
+           std::uint64_t      expectedNumA,
            std::uint64_t      expectedNumB,
            const std::string& input)
 {
-    std::istringstream stream(input);
-    const auto machines = getInput(stream);
-    if (machines.size() != 1) {
-        std::cerr << "bad input:\n" << input << std::endl;
-        return false;
-    }
-    std::uint64_t numA = 0, numB = 0;
-    minCoins(numA, numB, machines[0]);
-    if ((numA != expectedNumA) || (numB != expectedNumB)) {
-        std::cerr << "failure:\n" << input << "\n"
-                     "expected: (" << expectedNumA << ", " << expectedNumB << ")\n"
-                     "actual: (" << numA << ", " << numB << ")\n"
-                  << std::endl;
-        return false;
-    }
-    return true;
+    aoc::addCheck(lineNumber, [=] {
+        const auto machines = getInput(input);
+        if (machines.size() != 1) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << " bad input:\n" << input << std::endl;
+            return;
+        }
+        std::uint64_t numA = 0, numB = 0;
+        minCoins(numA, numB, machines[0]);
+        if ((numA != expectedNumA) || (numB != expectedNumB)) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):\n" << input
+                                  << "\nexpected: (" << expectedNumA << ", "
+                                  << expectedNumB << ")"
+                                  << "\nactual: (" << numA << ", " << numB
+                                  << ")"
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
 {
-    assert(check(0,1, "Button A: X+1, Y+1\n"
-                      "Button B: X+9, Y+9\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 0, 1, "Button A: X+1, Y+1\n"
+                          "Button B: X+9, Y+9\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(1,2, "Button A: X+1, Y+1\n"
-                      "Button B: X+4, Y+4\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 1, 2, "Button A: X+1, Y+1\n"
+                          "Button B: X+4, Y+4\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(1,4, "Button A: X+1, Y+1\n"
-                      "Button B: X+2, Y+2\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 1, 4, "Button A: X+1, Y+1\n"
+                          "Button B: X+2, Y+2\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(0,9, "Button A: X+1, Y+1\n"
-                      "Button B: X+1, Y+1\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 0, 9, "Button A: X+1, Y+1\n"
+                          "Button B: X+1, Y+1\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(1,0, "Button A: X+9, Y+9\n"
-                      "Button B: X+1, Y+1\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 1, 0, "Button A: X+9, Y+9\n"
+                          "Button B: X+1, Y+1\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(2,1, "Button A: X+4, Y+4\n"
-                      "Button B: X+1, Y+1\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 2, 1, "Button A: X+4, Y+4\n"
+                          "Button B: X+1, Y+1\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(0,9, "Button A: X+2, Y+2\n"
-                      "Button B: X+1, Y+1\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 0, 9, "Button A: X+2, Y+2\n"
+                          "Button B: X+1, Y+1\n"
+                          "Prize: X=9, Y=9\n");
 
-    assert(check(0,9, "Button A: X+1, Y+1\n"
-                      "Button B: X+1, Y+1\n"
-                      "Prize: X=9, Y=9\n"));
+    check(__LINE__, 0, 9, "Button A: X+1, Y+1\n"
+                          "Button B: X+1, Y+1\n"
+                          "Prize: X=9, Y=9\n");
 }
 
-int main()
+std::uint64_t solve(const std::vector<Machine>& machines)
 {
-    runTests();
-    const std::vector<Machine> machines = getInput();
     std::uint64_t total = 0;
     for (const Machine& machine : machines) {
         std::uint64_t numA = 0, numB = 0;
         minCoins(numA, numB, machine);
         total += (3*numA + numB);
     }
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+// Sum the tokens needed to win the prizes of the machines described by
+// 'lines' as they are read.
+template <class LINES>
+std::uint64_t solveStreaming(LINES&& lines)
+{
+    std::uint64_t total = 0;
+    Machine       machine{};
+    for (const std::string_view line : lines) {
+        if (parseMachineLine(line, machine)) {
+            std::uint64_t numA = 0, numB = 0;
+            minCoins(numA, numB, machine);
+            total += (3*numA + numB);
+        }
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    runTests();
+
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& machines) { return solve(machines); },
+        [] {
+            return solveStreaming(
+                        aoc::LineReader("day_13-claw_contraption-input.txt"));
+        });
 }
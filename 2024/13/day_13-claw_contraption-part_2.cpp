@@ -2,15 +2,18 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <numeric>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+
 struct Vec2 {
     std::int64_t d_x, d_y;
 };
@@ -19,45 +22,33 @@ struct Machine {
     Vec2 d_a, d_b, d_prize;
 };
 
-auto getInput(std::istream& stream)
+auto getInput(std::string_view input)
 {
     std::vector<Machine> machines;
-    const std::regex buttonMatcher("^Button ([AB]): X\\+(\\d+), Y\\+(\\d+)$"),
-                     prizeMatcher( "^Prize: X=(\\d+), Y=(\\d+)$");
-    while (stream) {
-        machines.emplace_back();
-        std::string line;
-        bool        haveMatch;
-        std::smatch match;
-
-        std::getline(stream, line);
-        assert(stream);
-        haveMatch = std::regex_search(line, match, buttonMatcher);
-        assert(haveMatch);
-        assert(match.size() == 4);
-        assert(match[1] == 'A');
-        machines.back().d_a.d_x = std::stoll(match[2]);
-        machines.back().d_a.d_y = std::stoll(match[3]);
-
-        std::getline(stream, line);
-        assert(stream);
-        haveMatch = std::regex_search(line, match, buttonMatcher);
-        assert(haveMatch);
-        assert(match.size() == 4);
-        assert(match[1] == 'B');
-        machines.back().d_b.d_x = std::stoll(match[2]);
-        machines.back().d_b.d_y = std::stoll(match[3]);
-
-        std::getline(stream, line);
-        assert(stream);
-        haveMatch = std::regex_search(line, match, prizeMatcher);
-        assert(haveMatch);
-        assert(match.size() == 3);
-        machines.back().d_prize.d_x = 10000000000000LL + std::stoll(match[1]);
-        machines.back().d_prize.d_y = 10000000000000LL + std::stoll(match[2]);
-
-        std::getline(stream, line);
-        assert(line.empty());
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); ) {
+        Machine& machine = machines.emplace_back();
+        const bool haveMatch =
+            scanner.consume("Button A: X+") &&
+            scanner.readInt(machine.d_a.d_x) && scanner.consume(", Y+") &&
+            scanner.readInt(machine.d_a.d_y) && scanner.consume('\n') &&
+            scanner.consume("Button B: X+") &&
+            scanner.readInt(machine.d_b.d_x) && scanner.consume(", Y+") &&
+            scanner.readInt(machine.d_b.d_y) && scanner.consume('\n') &&
+            scanner.consume("Prize: X=") &&
+            scanner.readInt(machine.d_prize.d_x) && scanner.consume(", Y=") &&
+            scanner.readInt(machine.d_prize.d_y) &&
+            (scanner.consume('\n') || scanner.atEnd());
+        if (!haveMatch) {
+            // Drop the record and skip the rest of the line that did not
+            // match (e.g. a stray line, or one ending in '\r'), so that the
+            // loop always advances.
+            machines.pop_back();
+            scanner.skipLine();
+            continue;
+        }
+        scanner.consume('\n');
+        machine.d_prize.d_x += 10000000000000LL;
+        machine.d_prize.d_y += 10000000000000LL;
     }
     assert(!machines.empty());
     return machines;
@@ -65,8 +56,38 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_13-claw_contraption-input.txt");
-    return getInput(stream);
+    const aoc::MappedFile file("day_13-claw_contraption-input.txt");
+    return getInput(file.view());
+}
+
+// Parse 'line', one line of a machine's description, into 'machine' and
+// return whether it was the last one (the prize).  Blank lines between
+// machines are ignored.
+bool parseMachineLine(std::string_view line, Machine& machine)
+{
+    aoc::Scanner scanner(line);
+    [[maybe_unused]] bool haveMatch = true;
+    bool isPrize = false;
+    if (scanner.consume("Button A: X+")) {
+        haveMatch = scanner.readInt(machine.d_a.d_x) &&
+                    scanner.consume(", Y+")          &&
+                    scanner.readInt(machine.d_a.d_y);
+    }
+    else if (scanner.consume("Button B: X+")) {
+        haveMatch = scanner.readInt(machine.d_b.d_x) &&
+                    scanner.consume(", Y+")          &&
+                    scanner.readInt(machine.d_b.d_y);
+    }
+    else if (scanner.consume("Prize: X=")) {
+        haveMatch = scanner.readInt(machine.d_prize.d_x) &&
+                    scanner.consume(", Y=")              &&
+                    scanner.readInt(machine.d_prize.d_y);
+        machine.d_prize.d_x += 10000000000000LL;
+        machine.d_prize.d_y += 10000000000000LL;
+        isPrize = true;
+    }
+    assert(haveMatch && scanner.atEnd());
+    return isPrize;
 }
 
 void minCoins(std::uint64_t& numA, std::uint64_t& numB, const Machine& machine)
@@ -152,8 +173,7 @@ bool check(std::uint64_t      expectedNumA,
            std::uint64_t      expectedNumB,
            const std::string& input)
 {
-    std::istringstream stream(input);
-    const auto machines = getInput(stream);
+    const auto machines = getInput(input);
     if (machines.size() != 1) {
         std::cerr << "bad input:\n" << input << std::endl;
         return false;
@@ -170,15 +190,42 @@ bool check(std::uint64_t      expectedNumA,
     return true;
 }
 
-int main()
+std::uint64_t solve(const std::vector<Machine>& machines)
 {
-    const std::vector<Machine> machines = getInput();
     std::uint64_t total = 0;
     for (const Machine& machine : machines) {
         std::uint64_t numA = 0, numB = 0;
         minCoins(numA, numB, machine);
         total += (3*numA + numB);
     }
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+// Sum the tokens needed to win the prizes of the machines described by
+// 'lines' as they are read.
+template <class LINES>
+std::uint64_t solveStreaming(LINES&& lines)
+{
+    std::uint64_t total = 0;
+    Machine       machine{};
+    for (const std::string_view line : lines) {
+        if (parseMachineLine(line, machine)) {
+            std::uint64_t numA = 0, numB = 0;
+            minCoins(numA, numB, machine);
+            total += (3*numA + numB);
+        }
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& machines) { return solve(machines); },
+        [] {
+            return solveStreaming(
+                        aoc::LineReader("day_13-claw_contraption-input.txt"));
+        });
 }
@@ -3,16 +3,18 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <numeric>
-#include <regex>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+#include <aoc/scanner.h>
+
 struct Vec2 {
     std::int64_t d_x, d_y;
 };
@@ -23,20 +25,25 @@ struct Robot {
 
 typedef std::array<std::array<std::int64_t, 2>, 2> QuadrantCounter;
 
-auto getInput(std::istream& stream)
+auto getInput(std::string_view input)
 {
     std::vector<Robot> robots;
-    const std::regex robotMatcher("^p=([^,]+),([^ ]+) v=([^,]+),(.+)$");
-    for (std::string line; std::getline(stream, line); ) {
-        robots.emplace_back();
-        std::smatch match;
-        const bool haveMatch = std::regex_search(line, match, robotMatcher);
-        assert(haveMatch);
-        assert(match.size() == 5);
-        robots.back().d_pos.d_x = std::stoll(match[1]);
-        robots.back().d_pos.d_y = std::stoll(match[2]);
-        robots.back().d_vel.d_x = std::stoll(match[3]);
-        robots.back().d_vel.d_y = std::stoll(match[4]);
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); ) {
+        Robot& robot = robots.emplace_back();
+        const bool haveMatch =
+            scanner.consume("p=") && scanner.readInt(robot.d_pos.d_x) &&
+            scanner.consume(',')  && scanner.readInt(robot.d_pos.d_y) &&
+            scanner.consume(" v=") && scanner.readInt(robot.d_vel.d_x) &&
+            scanner.consume(',')  && scanner.readInt(robot.d_vel.d_y) &&
+            (scanner.consume('\n') || scanner.atEnd());
+        if (!haveMatch) {
+            // Drop the record and skip the rest of the line that did not
+            // match (e.g. a stray line, or one ending in '\r'), so that the
+            // loop always advances.
+            robots.pop_back();
+            scanner.skipLine();
+            continue;
+        }
     }
     assert(!robots.empty());
     return robots;
@@ -44,15 +51,9 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    // std::ifstream stream("day_14-restroom_redoubt-input-example.txt");
-    std::ifstream stream("day_14-restroom_redoubt-input.txt");
-    return getInput(stream);
-}
-
-auto getInput(const std::string_view& input)
-{
-    std::istringstream stream{std::string(input)};
-    return getInput(stream);
+    // const aoc::MappedFile file("day_14-restroom_redoubt-input-example.txt");
+    const aoc::MappedFile file("day_14-restroom_redoubt-input.txt");
+    return getInput(file.view());
 }
 
 void updateRobot(Robot&       robot,
@@ -102,7 +103,7 @@ std::string display(const std::vector<Robot>& robots,
 {
     const auto lineSize = numCols+1;
     std::string output(numRows*lineSize, '.');
-    for (auto i = numCols; i < output.size(); i += lineSize)
+    for (auto i = numCols; i < std::ssize(output); i += lineSize)
         output[i] = '\n';
 
     for (const Robot& robot : robots) {
@@ -115,28 +116,30 @@ std::string display(const std::vector<Robot>& robots,
     return output;
 }
 
-bool check(const std::string_view& expectedOutput,
+void check(int                     lineNumber,
+           const std::string_view& expectedOutput,
            const std::string_view& input,
            std::int64_t            numRows,
            std::int64_t            numCols,
            std::int64_t            numSeconds)
 {
-    auto robots = getInput(input);
-    runSim(robots, numRows, numCols, numSeconds);
-    const auto output = display(robots, numRows, numCols);
-    if (output != expectedOutput) {
-        std::cerr << "failure:"
-                  << "\n> expected:\n" << expectedOutput
-                  << "\n> actual:\n" << output
-                  << std::endl;
-        return false;
-    }
-    return true;
+    aoc::addCheck(lineNumber, [=] {
+        auto robots = getInput(input);
+        runSim(robots, numRows, numCols, numSeconds);
+        const auto output = display(robots, numRows, numCols);
+        if (output != expectedOutput) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedOutput
+                                  << "\n> actual:\n" << output
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
 {
-    assert(check(
+    check(
+        __LINE__,
         "1.12.......\n"
         "...........\n"
         "...........\n"
@@ -158,8 +161,9 @@ void runTests()
         "p=9,5 v=-3,-3\n",
         7, 11,
         0
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "...........\n"
         "...........\n"
         "...........\n"
@@ -170,8 +174,9 @@ void runTests()
         "p=2,4 v=2,-3\n",
         7, 11,
         0
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "...........\n"
         "....1......\n"
         "...........\n"
@@ -182,8 +187,9 @@ void runTests()
         "p=2,4 v=2,-3\n",
         7, 11,
         1
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "...........\n"
         "...........\n"
         "...........\n"
@@ -194,8 +200,9 @@ void runTests()
         "p=2,4 v=2,-3\n",
         7, 11,
         2
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "...........\n"
         "...........\n"
         "........1..\n"
@@ -206,8 +213,9 @@ void runTests()
         "p=2,4 v=2,-3\n",
         7, 11,
         3
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "...........\n"
         "...........\n"
         "...........\n"
@@ -218,8 +226,9 @@ void runTests()
         "p=2,4 v=2,-3\n",
         7, 11,
         4
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "...........\n"
         "...........\n"
         "...........\n"
@@ -230,8 +239,9 @@ void runTests()
         "p=2,4 v=2,-3\n",
         7, 11,
         5
-    ));
-    assert(check(
+    );
+    check(
+        __LINE__,
         "......2..1.\n"
         "...........\n"
         "1..........\n"
@@ -253,13 +263,11 @@ void runTests()
         "p=9,5 v=-3,-3\n",
         7, 11,
         100
-    ));
+    );
 }
 
-int main()
+std::int64_t solve(std::vector<Robot>& robots)
 {
-    // runTests();
-    std::vector<Robot> robots = getInput();
     // std::int64_t numRows = 7, numCols = 11, numSeconds = 100;
     std::int64_t numRows = 103, numCols = 101, numSeconds = 100;
     runSim(robots, numRows, numCols, numSeconds);
@@ -271,6 +279,14 @@ int main()
     //           << ", Q4=" << q[1][1]
     //           << std::endl;
     const auto total = q[0][0] * q[0][1] * q[1][0] * q[1][1];
-    std::cout << total << std::endl;
-    return 0;
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    // runTests();
+
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& robots) { return solve(robots); });
 }
@@ -4,20 +4,21 @@
 #include <chrono>
 #include <cstdint>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <numeric>
-#include <regex>
 #include <set>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/phase.h>
+#include <aoc/scanner.h>
+
 struct Vec2 {
     std::int64_t d_x, d_y;
     auto operator<=>(const Vec2&) const = default;
@@ -30,20 +31,25 @@ struct Robot {
 
 typedef std::array<std::array<std::int64_t, 2>, 2> QuadrantCounter;
 
-auto getInput(std::istream& stream)
+auto getInput(std::string_view input)
 {
     std::vector<Robot> robots;
-    const std::regex robotMatcher("^p=([^,]+),([^ ]+) v=([^,]+),(.+)$");
-    for (std::string line; std::getline(stream, line); ) {
-        robots.emplace_back();
-        std::smatch match;
-        const bool haveMatch = std::regex_search(line, match, robotMatcher);
-        assert(haveMatch);
-        assert(match.size() == 5);
-        robots.back().d_pos.d_x = std::stoll(match[1]);
-        robots.back().d_pos.d_y = std::stoll(match[2]);
-        robots.back().d_vel.d_x = std::stoll(match[3]);
-        robots.back().d_vel.d_y = std::stoll(match[4]);
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); ) {
+        Robot& robot = robots.emplace_back();
+        const bool haveMatch =
+            scanner.consume("p=") && scanner.readInt(robot.d_pos.d_x) &&
+            scanner.consume(',')  && scanner.readInt(robot.d_pos.d_y) &&
+            scanner.consume(" v=") && scanner.readInt(robot.d_vel.d_x) &&
+            scanner.consume(',')  && scanner.readInt(robot.d_vel.d_y) &&
+            (scanner.consume('\n') || scanner.atEnd());
+        if (!haveMatch) {
+            // Drop the record and skip the rest of the line that did not
+            // match (e.g. a stray line, or one ending in '\r'), so that the
+            // loop always advances.
+            robots.pop_back();
+            scanner.skipLine();
+            continue;
+        }
     }
     assert(!robots.empty());
     return robots;
@@ -51,15 +57,9 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    // std::ifstream stream("day_14-restroom_redoubt-input-example.txt");
-    std::ifstream stream("day_14-restroom_redoubt-input.txt");
-    return getInput(stream);
-}
-
-auto getInput(const std::string_view& input)
-{
-    std::istringstream stream{std::string(input)};
-    return getInput(stream);
+    // const aoc::MappedFile file("day_14-restroom_redoubt-input-example.txt");
+    const aoc::MappedFile file("day_14-restroom_redoubt-input.txt");
+    return getInput(file.view());
 }
 
 void updateRobot(Robot&       robot,
@@ -116,7 +116,7 @@ std::string display(const std::vector<Robot>& robots,
 {
     const auto lineSize = numCols+1;
     std::string output(numRows*lineSize, ' ');
-    for (auto i = numCols; i < output.size(); i += lineSize)
+    for (auto i = numCols; i < std::ssize(output); i += lineSize)
         output[i] = '\n';
 
     for (const Robot& robot : robots) {
@@ -138,16 +138,19 @@ bool haveOverlap(const std::vector<Robot>& robots)
 int main()
 {
     // runTests();
-    std::vector<Robot> robots = getInput();
+    std::vector<Robot> robots = aoc::phase("getInput", [] { return getInput(); });
     std::int64_t numRows = 103, numCols = 101;
     const auto disp   = [&]() { return display(robots, numRows, numCols); };
     const auto update = [&]() { updateRobots(robots, numRows, numCols); };
     std::map<std::vector<Robot>, std::int64_t> state;
-    state[robots] = 0;
-    std::int64_t collisionTime = 0;
-    do {
-        update();
-    } while (state.emplace(robots, ++collisionTime).second);
+    const std::int64_t collisionTime = aoc::phase("findCycle", [&] {
+        state[robots] = 0;
+        std::int64_t time = 0;
+        do {
+            update();
+        } while (state.emplace(robots, ++time).second);
+        return time;
+    });
     std::cout << "collision: " << state[robots] << "=>" << collisionTime << std::endl;
 
     const std::int64_t onset = 84, stride = 101;
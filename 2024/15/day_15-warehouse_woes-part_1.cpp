@@ -2,16 +2,19 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <numeric>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Cursor {
     std::int64_t d_i, d_j;
 };
@@ -37,20 +40,21 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_15-warehouse_woes-input.txt");
+    const aoc::MappedFile file("day_15-warehouse_woes-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
 Cursor findRobot(const std::vector<std::string>& grid)
 {
-    for (std::int64_t i = 0; i < grid.size(); ++i)
-        for (std::int64_t j = 0; j < grid[i].size(); ++j)
+    for (std::int64_t i = 0; i < std::ssize(grid); ++i)
+        for (std::int64_t j = 0; j < std::ssize(grid[i]); ++j)
             if (grid[i][j] == '@')
                 return { .d_i = i, .d_j = j };
 
@@ -96,8 +100,8 @@ void update(std::vector<std::string>& grid, Cursor& robot, char command)
 std::int64_t sumBoxes(const std::vector<std::string>& grid)
 {
     std::int64_t total = 0;
-    for (std::int64_t i = 0; i < grid.size(); ++i)
-        for (std::int64_t j = 0; j < grid[i].size(); ++j)
+    for (std::int64_t i = 0; i < std::ssize(grid); ++i)
+        for (std::int64_t j = 0; j < std::ssize(grid[i]); ++j)
             if (grid[i][j] == 'O')
                 total += (100 * i + j);
 
@@ -124,17 +128,55 @@ std::string display(const std::vector<std::string>& grid)
     return str;
 }
 
-void check(std::int64_t expectedSum, const std::string_view& input)
+void checkGridTransition(int                             lineNumber,
+                         const std::vector<std::string>& pGrid,
+                         const std::vector<std::string>& nGrid,
+                         char                            command)
 {
-    auto [grid, commands] = getInput(input);
-    const std::int64_t sum = runSim(grid, commands);
-    if (sum != expectedSum) {
-        std::cerr << "failure:"
-                  << "\n> expected:\n" << expectedSum
-                  << "\n> actual:\n" << sum
-                  << "\n" << display(grid)
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        auto grid  = pGrid;
+        auto robot = findRobot(pGrid);
+        update(grid, robot, command);
+        if (grid != nGrid) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> initial:\n" << display(pGrid)
+                                  << "\n> command: " << command << "\n"
+                                  << "\n> expected:\n" << display(nGrid)
+                                  << "\n> actual:\n" << display(grid)
+                                  << std::endl;
+        }
+    });
+}
+
+void check(int                     lineNumber,
+           std::int64_t            expectedSum,
+           const std::string_view& input)
+{
+    aoc::addCheck(lineNumber, [=] {
+        auto [grid, commands] = getInput(input);
+        const std::int64_t sum = runSim(grid, commands);
+        if (sum != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedSum
+                                  << "\n> actual:\n" << sum
+                                  << "\n" << display(grid)
+                                  << std::endl;
+        }
+    });
+}
+
+void checkSumBoxes(int                             lineNumber,
+                   std::int64_t                    expectedSum,
+                   const std::vector<std::string>& grid)
+{
+    aoc::addCheck(lineNumber, [=] {
+        if (const std::int64_t sum = sumBoxes(grid); sum != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedSum
+                                  << "\n> actual:   " << sum
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -158,20 +200,10 @@ void runTests()
         { "########", "#....OO#", "##.....#", "#.....O#", "#.#O@..#", "#...O..#", "#...O..#", "########" },
     };
     const std::string_view commands = "<^^>>>vv<v>>v<<";
-    for (std::int64_t i = 0; i < commands.size(); ++i) {
-        auto grid  = grids[i];
-        auto robot = findRobot(grid);
-        update(grid, robot, commands[i]);
-        if (grid != grids[i+1]) {
-            std::cerr << "failure(" << i << "):"
-                      << "\n> initial:\n" << display(grids[i])
-                      << "\n> command: " << commands[i] << "\n"
-                      << "\n> expected:\n" << display(grids[i+1])
-                      << "\n> actual:\n" << display(grid)
-                      << std::endl;
-        }
-    }
+    for (std::int64_t i = 0; i < std::ssize(commands); ++i)
+        checkGridTransition(__LINE__, grids[i], grids[i+1], commands[i]);
     check(
+        __LINE__,
         2028,
         "########\n"
         "#..O.O.#\n"
@@ -184,7 +216,9 @@ void runTests()
         "\n"
         "<^^>>>vv<v>>v<<\n"
     );
-    assert(10092 == sumBoxes(
+    checkSumBoxes(
+        __LINE__,
+        10092,
         { { "##########" },
           { "#.O.O.OOO#" },
           { "#........#" },
@@ -195,8 +229,9 @@ void runTests()
           { "#O.....OO#" },
           { "#OO....OO#" },
           { "##########" } }
-    ));
+    );
     check(
+        __LINE__,
         10092,
         "##########\n"
         "#..O..O.O#\n"
@@ -222,12 +257,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    auto [grid, commands] = getInput();
-    const auto total = runSim(grid, commands);
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& input) { return runSim(input.first, input.second); });
 }
@@ -2,9 +2,9 @@
 #include <cassert>
 #include <chrono>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <ranges>
+#include <spanstream>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -12,6 +12,10 @@
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Cursor {
     std::int64_t d_i, d_j;
     auto operator<=>(const Cursor&) const = default;
@@ -40,7 +44,7 @@ void transformCell(char& out1, char& out2, char cell)
 void transformRow(std::string& row)
 {
     std::string output(row.size() * 2, 'X');
-    for (std::int64_t i = 0; i < row.size(); ++i)
+    for (std::int64_t i = 0; i < std::ssize(row); ++i)
         transformCell(output[2*i], output[2*i+1], row[i]);
 
     row = std::move(output);
@@ -74,20 +78,21 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_15-warehouse_woes-input.txt");
+    const aoc::MappedFile file("day_15-warehouse_woes-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
 Cursor findRobot(const std::vector<std::string>& grid)
 {
-    for (std::int64_t i = 0; i < grid.size(); ++i)
-        for (std::int64_t j = 0; j < grid[i].size(); ++j)
+    for (std::int64_t i = 0; i < std::ssize(grid); ++i)
+        for (std::int64_t j = 0; j < std::ssize(grid[i]); ++j)
             if (grid[i][j] == '@')
                 return { .d_i = i, .d_j = j };
 
@@ -195,8 +200,8 @@ bool update(std::vector<std::string>& grid, Cursor& robot, char command)
 std::int64_t sumBoxes(const std::vector<std::string>& grid)
 {
     std::int64_t total = 0;
-    for (std::int64_t i = 0; i < grid.size(); ++i)
-        for (std::int64_t j = 0; j < grid[i].size(); ++j)
+    for (std::int64_t i = 0; i < std::ssize(grid); ++i)
+        for (std::int64_t j = 0; j < std::ssize(grid[i]); ++j)
             if (grid[i][j] == '[')
                 total += (100 * i + j);
 
@@ -226,9 +231,9 @@ std::int64_t runSim(std::vector<std::string>& grid,
             output += "\n\ncommand(" + std::to_string(++i) + "/" + std::to_string(commands.size()) + "): ";
             output += command;
         }
-        const auto prevRobot = robot;
-        const auto prevGrid  = grid;
-        const bool success   = update(grid, robot, command);
+        [[maybe_unused]] const auto prevRobot = robot;
+        const auto prevGrid = grid;
+        const bool success  = update(grid, robot, command);
         if (success) {
             assert(robot != prevRobot);
             assert(grid != prevGrid);
@@ -266,57 +271,87 @@ std::vector<std::string> gridFromString(const std::string_view& str)
     return grid;
 }
 
-void checkTransform(const std::string_view& output, const std::string_view& input)
+void checkTransform(int                     lineNumber,
+                    const std::string_view& output,
+                    const std::string_view& input)
 {
-    std::vector<std::string> oGrid(gridFromString(output)), iGrid(gridFromString(input));
-    transformGrid(iGrid);
-    if (oGrid != iGrid) {
-        std::cerr << "failure:"
-                  << "\n> expected:\n" << output
-                  << "\n> actual:\n" << display(iGrid)
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        std::vector<std::string> oGrid(gridFromString(output)),
+                                 iGrid(gridFromString(input));
+        transformGrid(iGrid);
+        if (oGrid != iGrid) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << output
+                                  << "\n> actual:\n" << display(iGrid)
+                                  << std::endl;
+        }
+    });
 }
 
-void checkGridTransition(const std::vector<std::string>& pGrid,
+void checkGridTransition(int                             lineNumber,
+                         const std::vector<std::string>& pGrid,
                          const std::vector<std::string>& nGrid,
                          char                            command)
 {
-    auto grid  = pGrid;
-    auto robot = findRobot(pGrid);
-    update(grid, robot, command);
-    if (grid != nGrid) {
-        std::cerr << "\n> initial:\n" << display(pGrid)
-                  << "\n> command: " << command << "\n"
-                  << "\n> expected:\n" << display(nGrid)
-                  << "\n> actual:\n" << display(grid)
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        auto grid  = pGrid;
+        auto robot = findRobot(pGrid);
+        update(grid, robot, command);
+        if (grid != nGrid) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> initial:\n" << display(pGrid)
+                                  << "\n> command: " << command << "\n"
+                                  << "\n> expected:\n" << display(nGrid)
+                                  << "\n> actual:\n" << display(grid)
+                                  << std::endl;
+        }
+    });
 }
 
-void checkTransition(const std::string_view& pGrid,
+void checkTransition(int                     lineNumber,
+                     const std::string_view& pGrid,
                      const std::string_view& nGrid,
                      char                    command)
 {
-    return checkGridTransition(gridFromString(pGrid), gridFromString(nGrid), command);
+    checkGridTransition(lineNumber, gridFromString(pGrid),
+                        gridFromString(nGrid), command);
 }
 
-void check(std::int64_t expectedSum, const std::string_view& input)
+void check(int                     lineNumber,
+           std::int64_t            expectedSum,
+           const std::string_view& input)
 {
-    auto [grid, commands] = getInput(input);
-    const std::int64_t sum = runSim(grid, commands);
-    if (sum != expectedSum) {
-        std::cerr << "failure:"
-                  << "\n> expected:\n" << expectedSum
-                  << "\n> actual:\n" << sum
-                  << "\n" << display(grid)
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        auto [grid, commands] = getInput(input);
+        const std::int64_t sum = runSim(grid, commands);
+        if (sum != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedSum
+                                  << "\n> actual:\n" << sum
+                                  << "\n" << display(grid)
+                                  << std::endl;
+        }
+    });
+}
+
+void checkSumBoxes(int                             lineNumber,
+                   std::int64_t                    expectedSum,
+                   const std::vector<std::string>& grid)
+{
+    aoc::addCheck(lineNumber, [=] {
+        if (const std::int64_t sum = sumBoxes(grid); sum != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedSum
+                                  << "\n> actual:   " << sum
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
 {
     checkTransform(
+        __LINE__,
         "##############\n"
         "##......##..##\n"
         "##..........##\n"
@@ -333,6 +368,7 @@ void runTests()
         "#######\n"
     );
 	checkTransform(
+        __LINE__,
         "####################\n"
         "##....[]....[]..[]##\n"
         "##............[]..##\n"
@@ -369,10 +405,11 @@ void runTests()
 		 { "##############", "##...[].##..##", "##...@.[]...##", "##....[]....##", "##..........##", "##..........##", "##############" },
     };
     const std::string_view commands = "<vv<<^^<<^^";
-    for (std::int64_t i = 0; i < commands.size(); ++i)
-        checkGridTransition(grids[i], grids[i+1], commands[i]);
+    for (std::int64_t i = 0; i < std::ssize(commands); ++i)
+        checkGridTransition(__LINE__, grids[i], grids[i+1], commands[i]);
 
     checkTransition(
+    __LINE__,
     "#######\n"
     "#.....#\n"
     "#.[]..#\n"
@@ -391,6 +428,7 @@ void runTests()
     );
 
     checkTransition(
+    __LINE__,
     "#######\n"
     "#.....#\n"
     "#.[]..#\n"
@@ -409,6 +447,7 @@ void runTests()
     );
 
     checkTransition(
+    __LINE__,
     "#######\n"
     "#.....#\n"
     "#..[].#\n"
@@ -427,6 +466,7 @@ void runTests()
     );
 
     checkTransition(
+    __LINE__,
     "#######\n"
     "#.....#\n"
     "#.[]..#\n"
@@ -445,6 +485,7 @@ void runTests()
     );
 
     checkTransition(
+    __LINE__,
    "##########\n"
    "#...@....#\n"
    "#...[]...#\n"
@@ -473,6 +514,7 @@ void runTests()
     );
 
     checkTransition(
+    __LINE__,
    "##########\n"
    "#...@....#\n"
    "#...[]...#\n"
@@ -501,7 +543,9 @@ void runTests()
     );
 
 
-    assert(9021 == sumBoxes(
+    checkSumBoxes(
+        __LINE__,
+        9021,
         { { "####################" },
           { "##[].......[].[][]##" },
           { "##[]...........[].##" },
@@ -512,8 +556,9 @@ void runTests()
           { "##..@......[].[][]##" },
           { "##......[][]..[]..##" },
           { "####################" } }
-    ));
+    );
     check(
+        __LINE__,
         9021,
         "##########\n"
         "#..O..O.O#\n"
@@ -539,12 +584,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    auto [grid, commands] = getInput();
-    const auto total = runSim(grid, commands);
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& input) { return runSim(input.first, input.second); });
 }
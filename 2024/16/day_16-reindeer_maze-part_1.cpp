@@ -1,17 +1,20 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <queue>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 enum Dir { e_West, e_North, e_East, e_South };
 constexpr int k_Dir[] = { 0, -1, 0, +1, 0 };
 
@@ -42,20 +45,21 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_16-reindeer_maze-input.txt");
+    const aoc::MappedFile file("day_16-reindeer_maze-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
 Cursor findStart(const std::vector<std::string>& maze)
 {
-	for (std::int32_t i = 0; i < maze.size(); ++i)
-		for (std::int32_t j = 0; j < maze[i].size(); ++j)
+	for (std::int32_t i = 0; i < std::ssize(maze); ++i)
+		for (std::int32_t j = 0; j < std::ssize(maze[i]); ++j)
 			if (maze[i][j] == 'S')
                 return { .d_i = i, .d_j = j, .d_d = e_East };
 
@@ -109,21 +113,26 @@ std::int64_t solve(const std::vector<std::string>& maze)
     }
 }
 
-void check(std::int64_t expectedScore, const std::string_view& input)
+void check(int                     lineNumber,
+           std::int64_t            expectedScore,
+           const std::string_view& input)
 {
-    const auto grid = getInput(input);
-    const std::int64_t score = solve(grid);
-    if (score != expectedScore) {
-        std::cerr << "failure:"
-                  << "\n> expected:\n" << expectedScore
-                  << "\n> actual:\n" << score
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const auto grid = getInput(input);
+        const std::int64_t score = solve(grid);
+        if (score != expectedScore) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedScore
+                                  << "\n> actual:\n" << score
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
 {
 	check(
+		__LINE__,
 		7036,
 		"###############\n"
 		"#.......#....E#\n"
@@ -142,6 +151,7 @@ void runTests()
 		"###############\n"
 	);
 	check(
+		__LINE__,
 		11048,
 		"#################\n"
 		"#...#...#...#..E#\n"
@@ -163,12 +173,11 @@ void runTests()
 	);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto maze = getInput();
-    const auto score = solve(maze);
-    std::cout << score << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& maze) { return solve(maze); });
 }
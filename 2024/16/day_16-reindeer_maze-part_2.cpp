@@ -1,18 +1,21 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <queue>
 #include <set>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 enum Dir { e_West, e_North, e_East, e_South };
 constexpr int k_Dir[] = { 0, -1, 0, +1, 0 };
 
@@ -47,20 +50,21 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_16-reindeer_maze-input.txt");
+    const aoc::MappedFile file("day_16-reindeer_maze-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
 Point findCell(const std::vector<std::string>& maze, char cell)
 {
-	for (std::int32_t i = 0; i < maze.size(); ++i)
-		for (std::int32_t j = 0; j < maze[i].size(); ++j)
+	for (std::int32_t i = 0; i < std::ssize(maze); ++i)
+		for (std::int32_t j = 0; j < std::ssize(maze[i]); ++j)
 			if (maze[i][j] == cell)
                 return { .d_i = i, .d_j = j };
 
@@ -165,21 +169,26 @@ std::int64_t solve(const std::vector<std::string>& maze, bool debug = false)
     return seats.size();
 }
 
-void check(std::int64_t expectedScore, const std::string_view& input)
+void check(int                     lineNumber,
+           std::int64_t            expectedScore,
+           const std::string_view& input)
 {
-    const auto grid = getInput(input);
-    const std::int64_t score = solve(grid);
-    if (score != expectedScore) {
-        std::cerr << "failure:"
-                  << "\n> expected:\n" << expectedScore
-                  << "\n> actual:\n" << score
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const auto grid = getInput(input);
+        const std::int64_t score = solve(grid);
+        if (score != expectedScore) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedScore
+                                  << "\n> actual:\n" << score
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
 {
 	check(
+		__LINE__,
 		45,
 		"###############\n"
 		"#.......#....E#\n"
@@ -198,6 +207,7 @@ void runTests()
 		"###############\n"
 	);
 	check(
+		__LINE__,
 		64,
 		"#################\n"
 		"#...#...#...#..E#\n"
@@ -219,12 +229,11 @@ void runTests()
 	);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto maze = getInput();
-    const auto score = solve(maze);
-    std::cout << score << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& maze) { return solve(maze); });
 }
@@ -1,18 +1,22 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <optional>
 #include <queue>
+#include <spanstream>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 enum Instruction {
     e_adv = 0,
     e_bxl = 1,
@@ -83,13 +87,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_17-chronospatial_computer-input.txt");
+    const aoc::MappedFile file("day_17-chronospatial_computer-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -202,7 +207,7 @@ std::string displayOutput(const std::vector<std::int8_t>& output)
 
 std::string runSim(Computer& computer)
 {
-    while (computer.d_ip < computer.d_prog.size())
+    while (computer.d_ip < std::ssize(computer.d_prog))
         execInstruction(computer);
 
     return displayOutput(computer.d_output);
@@ -212,12 +217,15 @@ void checkInstruction(int             lineNumber,
                       const Computer& expectedOutputState,
                       const Computer& inputState)
 {
-    Computer outputState = inputState;
-    execInstruction(outputState);
-    if (outputState != expectedOutputState) {
-        std::cerr << "Unexpected output state! (" << lineNumber << ")"
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        Computer outputState = inputState;
+        execInstruction(outputState);
+        if (outputState != expectedOutputState) {
+            *aoc::failureStream()
+                << "Unexpected output state! (" << lineNumber << ")"
+                << std::endl;
+        }
+    });
 }
 
 void check(int                            lineNumber,
@@ -225,18 +233,21 @@ void check(int                            lineNumber,
            const std::string_view&        input,
            const std::optional<Computer>& expectedOutputState = std::nullopt)
 {
-    Computer          computer = getInput(input);
-    const std::string output   = runSim(computer);
-    if (output != expectedOutput) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected:\n" << expectedOutput
-                  << "\n> actual:\n" << output
-                  << std::endl;
-    }
-    if (expectedOutputState && (computer != *expectedOutputState)) {
-        std::cerr << "Unexpected output state! (" << lineNumber << ")"
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        Computer          computer = getInput(input);
+        const std::string output   = runSim(computer);
+        if (output != expectedOutput) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedOutput
+                                  << "\n> actual:\n" << output
+                                  << std::endl;
+        }
+        if (expectedOutputState && (computer != *expectedOutputState)) {
+            *aoc::failureStream()
+                << "Unexpected output state! (" << lineNumber << ")"
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -287,12 +298,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    auto              computer = getInput();
-    const std::string output   = runSim(computer);
-    std::cout << output << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](auto& computer) { return runSim(computer); });
 }
@@ -1,19 +1,23 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <numeric>
 #include <optional>
 #include <queue>
+#include <spanstream>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 enum Instruction {
     e_adv = 0,
     e_bxl = 1,
@@ -84,13 +88,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_17-chronospatial_computer-input.txt");
+    const aoc::MappedFile file("day_17-chronospatial_computer-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -182,7 +187,7 @@ void execInstruction(Computer& computer)
 
 void runSim(Computer& computer)
 {
-    while (computer.d_ip < computer.d_prog.size())
+    while (computer.d_ip < std::ssize(computer.d_prog))
         execInstruction(computer);
 }
 
@@ -261,15 +266,17 @@ void check(int                     lineNumber,
            std::int64_t            expectedRegA,
            const std::string_view& input)
 {
-    const Computer     computer = getInput(input);
-    const std::int64_t regA     = solve(computer);
+    aoc::addCheck(lineNumber, [=] {
+        const Computer     computer = getInput(input);
+        const std::int64_t regA     = solve(computer);
 
-    if (regA != expectedRegA) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected:\n" << expectedRegA
-                  << "\n> actual:\n" << regA
-                  << std::endl;
-    }
+        if (regA != expectedRegA) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedRegA
+                                  << "\n> actual:\n" << regA
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -285,12 +292,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const Computer     computer = getInput();
-    const std::int64_t regA     = solve(computer);
-    std::cout << regA << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& computer) { return solve(computer); });
 }
@@ -2,15 +2,18 @@
 #include <cassert>
 #include <charconv>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <queue>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getLines(std::istream& stream)
 {
     std::vector<std::string> lines;
@@ -49,13 +52,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_18-ram_run-input.txt");
+    const aoc::MappedFile file("day_18-ram_run-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -106,13 +110,15 @@ void check(int                     lineNumber,
            std::int64_t            numBytes,
            const std::string_view& input)
 {
-    const std::int64_t numSteps = runSim(gridSize, numBytes, getInput(input));
-    if (numSteps != expectedNumSteps) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected:\n" << expectedNumSteps
-                  << "\n> actual:\n" << numSteps
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numSteps = runSim(gridSize, numBytes, getInput(input));
+        if (numSteps != expectedNumSteps) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << expectedNumSteps
+                                  << "\n> actual:\n" << numSteps
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -150,11 +156,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numSteps = runSim(71, 1024, getInput());
-    std::cout << numSteps << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& bytes) { return runSim(71, 1024, bytes); });
 }
@@ -3,17 +3,20 @@
 #include <charconv>
 #include <cstdint>
 #include <deque>
-#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getLines(std::istream& stream)
 {
     std::vector<std::string> lines;
@@ -40,13 +43,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_18-ram_run-input.txt");
+    const aoc::MappedFile file("day_18-ram_run-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -131,13 +135,15 @@ void check(int                                lineNumber,
            std::int64_t                       gridSize,
            const std::string_view&            input)
 {
-    const auto byte = runSim(gridSize, getInput(input));
-    if (byte != expectedByte) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected:\n" << '(' << expectedByte[0] << ',' << expectedByte[1] << ')'
-                  << "\n> actual:\n" <<  '(' << byte[0] << ',' << byte[1] << ')'
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const auto byte = runSim(gridSize, getInput(input));
+        if (byte != expectedByte) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected:\n" << '(' << expectedByte[0] << ',' << expectedByte[1] << ')'
+                                  << "\n> actual:\n" <<  '(' << byte[0] << ',' << byte[1] << ')'
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -174,12 +180,17 @@ void runTests()
     );
 }
 
-int main()
+std::string solve(const std::vector<std::array<std::int64_t, 2>>& bytes)
+{
+    const std::array<std::int64_t, 2> byte = runSim(71, bytes);
+    return std::to_string(byte[0]) + ',' + std::to_string(byte[1]);
+}
+
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const std::array<std::int64_t, 2> byte = runSim(71, getInput()), expected = { 22, 33 };
-    std::cout << byte[0] << ',' << byte[1] << std::endl;
-    assert(byte == expected);
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& bytes) { return solve(bytes); });
 }
@@ -3,15 +3,22 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
-#include <sstream>
+#include <memory_resource>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/arena.h>
+#include <aoc/checks.h>
+#include <aoc/digest.h>
+#include <aoc/mapped_file.h>
+#include <aoc/result_cache.h>
+#include <aoc/run.h>
+
 struct TrieNode {
     bool                         d_isEnd;
     std::array<std::int16_t, 26> d_next;
@@ -51,13 +58,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_19-linen_layout-input.txt");
+    const aoc::MappedFile file("day_19-linen_layout-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -82,7 +90,9 @@ std::vector<TrieNode> makeTrie(const std::vector<std::string>& patterns)
 
 bool canMakeDesign(const std::vector<TrieNode>& trie, const std::string& design)
 {
-    std::vector<bool> canMake(design.size()+1);
+    aoc::ArenaScope        scratch;
+    std::pmr::vector<bool> canMake(design.size()+1, false,
+                                   scratch.resource());
     canMake[0] = true;
     for (std::string::size_type pSize = 0; pSize < design.size(); ++pSize) if (canMake[pSize]) {
         std::int16_t n = 0;
@@ -102,10 +112,21 @@ std::int64_t solve(const std::vector<std::string>& patterns,
                    const std::vector<std::string>& designs)
 {
 
-    return std::count_if(designs.begin(), designs.end(),
-                         [trie=makeTrie(patterns)](const std::string& design) {
-                             return canMakeDesign(trie, design);
-                         });
+    // Per design, under the digest of the patterns as well.
+    static aoc::ResultCache s_cache("2024/19-part_1", "1");
+    aoc::Hasher patternsHasher;
+    if (s_cache.isEnabled()) {
+        for (const std::string& pattern : patterns)
+            patternsHasher.add(pattern);
+    }
+
+    return std::count_if(
+        designs.begin(), designs.end(),
+        [&, trie=makeTrie(patterns)](const std::string& design) {
+            return s_cache.findOrCompute(
+                aoc::Hasher(patternsHasher).add(design).digest(),
+                [&] { return canMakeDesign(trie, design); });
+        });
 }
 
 std::int64_t solve(
@@ -118,13 +139,15 @@ void check(int                     lineNumber,
            std::int64_t            expectedNumDesigns,
            const std::string_view& input)
 {
-    const std::int64_t numDesigns = solve(getInput(input));
-    if (numDesigns != expectedNumDesigns) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumDesigns
-                  << "\n> actual:   " << numDesigns
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numDesigns = solve(getInput(input));
+        if (numDesigns != expectedNumDesigns) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumDesigns
+                                  << "\n> actual:   " << numDesigns
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -145,11 +168,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numDesigns = solve(getInput());
-    std::cout << numDesigns << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
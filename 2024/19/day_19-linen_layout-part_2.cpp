@@ -3,17 +3,24 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <memory_resource>
 #include <numeric>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/arena.h>
+#include <aoc/checks.h>
+#include <aoc/digest.h>
+#include <aoc/mapped_file.h>
+#include <aoc/result_cache.h>
+#include <aoc/run.h>
+
 struct TrieNode {
     bool                         d_isEnd;
     std::array<std::int16_t, 26> d_next;
@@ -53,13 +60,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_19-linen_layout-input.txt");
+    const aoc::MappedFile file("day_19-linen_layout-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -85,7 +93,8 @@ std::vector<TrieNode> makeTrie(const std::vector<std::string>& patterns)
 std::int64_t numWaysToMake(const std::vector<TrieNode>& trie,
                            const std::string&           design)
 {
-    std::vector<std::int64_t> numWays(design.size()+1);
+    aoc::ArenaScope                scratch;
+    std::pmr::vector<std::int64_t> numWays(design.size()+1, scratch.resource());
     numWays[0] = 1;
     for (std::string::size_type pSize = 0; pSize < design.size(); ++pSize) {
         if (!numWays[pSize])
@@ -109,10 +118,20 @@ std::int64_t solve(const std::vector<std::string>& patterns,
                    const std::vector<std::string>& designs)
 {
 
+    // Per design, under the digest of the patterns as well.
+    static aoc::ResultCache s_cache("2024/19-part_2", "1");
+    aoc::Hasher patternsHasher;
+    if (s_cache.isEnabled()) {
+        for (const std::string& pattern : patterns)
+            patternsHasher.add(pattern);
+    }
+
     return std::transform_reduce(
         designs.begin(), designs.end(), 0LL, std::plus{},
-        [trie=makeTrie(patterns)](const std::string& design) {
-            return numWaysToMake(trie, design);
+        [&, trie=makeTrie(patterns)](const std::string& design) {
+            return s_cache.findOrCompute(
+                aoc::Hasher(patternsHasher).add(design).digest(),
+                [&] { return numWaysToMake(trie, design); });
         });
 }
 
@@ -126,13 +145,15 @@ void check(int                     lineNumber,
            std::int64_t            expectedNumDesigns,
            const std::string_view& input)
 {
-    const std::int64_t numDesigns = solve(getInput(input));
-    if (numDesigns != expectedNumDesigns) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumDesigns
-                  << "\n> actual:   " << numDesigns
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numDesigns = solve(getInput(input));
+        if (numDesigns != expectedNumDesigns) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumDesigns
+                                  << "\n> actual:   " << numDesigns
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -153,11 +174,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numDesigns = solve(getInput());
-    std::cout << numDesigns << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
@@ -3,17 +3,21 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <limits>
 #include <queue>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
-constexpr int Dir[] = { 0, +1, 0, -1, 0 };
+#include <aoc/checks.h>
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
 
 auto getLines(std::istream& stream)
 {
@@ -26,63 +30,40 @@ auto getLines(std::istream& stream)
 
 auto getInput(std::istream& stream)
 {
-    const auto grid = getLines(stream);
-    assert(!grid.empty());
-    const auto numCols = grid.empty() ? 0 : grid[0].size();
-    const bool isGrid = std::all_of(grid.begin(), grid.end(),
-                                    [=](const std::string& row) {
-                                        return row.size() == numCols;
-                                    });
-    assert(isGrid);
-    return grid;
+    const auto lines = getLines(stream);
+    assert(!lines.empty());
+    return aoc::Grid<char>::fromRows(lines, '#');
 }
 
 auto getInput()
 {
-    std::ifstream stream("day_20-race_condition-input.txt");
+    const aoc::MappedFile file("day_20-race_condition-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
-std::array<std::int64_t, 2> findToken(const std::vector<std::string>& grid,
-                                      char                            token)
+aoc::Grid<std::int64_t> bfs(const aoc::Grid<char>& grid, Index start)
 {
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    for (std::int64_t i = 0; i < m; ++i)
-        for (std::int64_t j = 0; j < n; ++j)
-            if (grid[i][j] == token)
-                return { i, j };
-
-    assert(!"invalid input");
-    std::unreachable();
-}
-
-std::vector<std::vector<std::int64_t>> bfs(
-                                      const std::vector<std::string>&    grid,
-                                      const std::array<std::int64_t, 2>& start)
-{
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    std::vector<std::vector<std::int64_t>> dist(
-                                            m,
-                                            std::vector<std::int64_t>(n, m*n));
-    dist[start[0]][start[1]] = 0;
-    std::queue<std::array<std::int64_t, 2>> frontier;
+    const std::int64_t unreached = grid.numRows() * grid.numCols();
+    aoc::Grid<std::int64_t> dist(grid, unreached, unreached);
+    dist[start] = 0;
+    std::queue<Index> frontier;
     frontier.push(start);
     for (std::int64_t numSteps = 1; !frontier.empty(); ++numSteps) {
         for (std::int64_t remSize = frontier.size(); remSize > 0; --remSize) {
-            const auto [i, j] = frontier.front();
+            const Index index = frontier.front();
             frontier.pop();
-            for (int d = 0; d < 4; ++d) {
-                const auto nI = i+Dir[d], nJ = j+Dir[d+1];
-                if ((nI >= 0) && (nI < m) && (nJ >= 0) && (nJ < n) &&
-                    (grid[nI][nJ] != '#') && (dist[nI][nJ] > numSteps)) {
-                    dist[nI][nJ] = numSteps;
-                    frontier.push({ nI, nJ });
+            for (const Index offset : grid.neighbors()) {
+                if (const Index next = index + offset;
+                    (grid[next] != '#') && (dist[next] > numSteps)) {
+                    dist[next] = numSteps;
+                    frontier.push(next);
                 }
             }
         }
@@ -90,30 +71,28 @@ std::vector<std::vector<std::int64_t>> bfs(
     return dist;
 }
 
-std::int64_t solve(std::int64_t                    threshold,
-                   const std::vector<std::string>& grid)
+std::int64_t solve(std::int64_t threshold, const aoc::Grid<char>& grid)
 {
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    const auto start = findToken(grid, 'S'), end = findToken(grid, 'E');
+    const Index start = grid.find('S'), end = grid.find('E');
+    assert((start >= 0) && (end >= 0));
     const auto fromStart = bfs(grid, start), fromEnd = bfs(grid, end);
-    assert(fromStart[end[0]][end[1]] == fromEnd[start[0]][start[1]]);
-    const std::int64_t cutoff = fromStart[end[0]][end[1]] - threshold;
+    assert(fromStart[end] == fromEnd[start]);
+    const std::int64_t cutoff = fromStart[end] - threshold;
     std::int64_t total = 0;
-    for (std::int64_t i = 0; i < m; ++i) {
-        for (std::int64_t j = 0; j < n; ++j) {
-            if (grid[i][j] != '#')
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        for (Index j = 0; j < grid.numCols(); ++j) {
+            const Index index = grid.index(i, j);
+            if (grid[index] != '#')
                 continue;
 
             for (int d = 0; d < 2; ++d) {
-                const auto i1 = i+Dir[d], j1 = j+Dir[d+1],
-                           i2 = i-Dir[d], j2 = j-Dir[d+1];
-                if ((i1 < 0) || (i1 >= m) || (j1 < 0) || (j1 >= n) ||
-                    (i2 < 0) || (i2 >= m) || (j2 < 0) || (j2 >= n) ||
-                    (grid[i1][j1] == '#') || (grid[i2][j2] == '#'))
+                const Index i1 = index + grid.neighbors()[d],
+                            i2 = index - grid.neighbors()[d];
+                if ((grid[i1] == '#') || (grid[i2] == '#'))
                     continue;
 
-                const auto distA = fromStart[i1][j1] + 1 + fromEnd[i2][j2],
-                           distB = fromStart[i2][j2] + 1 + fromEnd[i1][j1];
+                const auto distA = fromStart[i1] + 1 + fromEnd[i2],
+                           distB = fromStart[i2] + 1 + fromEnd[i1];
                 total += (distA <= cutoff);
                 total += (distB <= cutoff);
             }
@@ -127,13 +106,15 @@ void check(int                     lineNumber,
            std::int64_t            threshold,
            const std::string_view& input)
 {
-    const std::int64_t numCheats = solve(threshold, getInput(input));
-    if (numCheats != expectedNumCheats) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumCheats
-                  << "\n> actual:   " << numCheats
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numCheats = solve(threshold, getInput(input));
+        if (numCheats != expectedNumCheats) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumCheats
+                                  << "\n> actual:   " << numCheats
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -162,11 +143,11 @@ void runTests()
     }
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numCheats = solve(100, getInput());
-    std::cout << numCheats << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(100, input); });
 }
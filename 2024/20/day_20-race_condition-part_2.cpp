@@ -4,18 +4,24 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <limits>
 #include <numeric>
 #include <queue>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
+
 constexpr int Dir[] = { 0, +1, 0, -1, 0 };
 
 auto getLines(std::istream& stream)
@@ -27,65 +33,45 @@ auto getLines(std::istream& stream)
     return lines;
 }
 
+// Longest cheat the grid's border is wide enough for.
+constexpr std::int64_t k_MaxCheatStride = 20;
+
 auto getInput(std::istream& stream)
 {
-    const auto grid = getLines(stream);
-    assert(!grid.empty());
-    const auto numCols = grid.empty() ? 0 : grid[0].size();
-    const bool isGrid = std::all_of(grid.begin(), grid.end(),
-                                    [=](const std::string& row) {
-                                        return row.size() == numCols;
-                                    });
-    assert(isGrid);
-    return grid;
+    const auto lines = getLines(stream);
+    assert(!lines.empty());
+    return aoc::Grid<char>::fromRows(lines, '#', k_MaxCheatStride);
 }
 
 auto getInput()
 {
-    std::ifstream stream("day_20-race_condition-input.txt");
+    const aoc::MappedFile file("day_20-race_condition-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
-std::array<std::int64_t, 2> findToken(const std::vector<std::string>& grid,
-                                      char                            token)
-{
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    for (std::int64_t i = 0; i < m; ++i)
-        for (std::int64_t j = 0; j < n; ++j)
-            if (grid[i][j] == token)
-                return { i, j };
-
-    assert(!"invalid input");
-    std::unreachable();
-}
-
-std::vector<std::vector<std::int64_t>> bfs(
-                                      const std::vector<std::string>&    grid,
-                                      const std::array<std::int64_t, 2>& start)
+aoc::Grid<std::int64_t> bfs(const aoc::Grid<char>& grid, Index start)
 {
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    std::vector<std::vector<std::int64_t>> dist(
-                                            m,
-                                            std::vector<std::int64_t>(n, m*n));
-    dist[start[0]][start[1]] = 0;
-    std::queue<std::array<std::int64_t, 2>> frontier;
+    const std::int64_t unreached = grid.numRows() * grid.numCols();
+    aoc::Grid<std::int64_t> dist(grid, unreached, unreached);
+    dist[start] = 0;
+    std::queue<Index> frontier;
     frontier.push(start);
     for (std::int64_t numSteps = 1; !frontier.empty(); ++numSteps) {
         for (std::int64_t remSize = frontier.size(); remSize > 0; --remSize) {
-            const auto [i, j] = frontier.front();
+            const Index index = frontier.front();
             frontier.pop();
-            for (int d = 0; d < 4; ++d) {
-                const auto nI = i+Dir[d], nJ = j+Dir[d+1];
-                if ((nI >= 0) && (nI < m) && (nJ >= 0) && (nJ < n) &&
-                    (grid[nI][nJ] != '#') && (dist[nI][nJ] > numSteps)) {
-                    dist[nI][nJ] = numSteps;
-                    frontier.push({ nI, nJ });
+            for (const Index offset : grid.neighbors()) {
+                if (const Index next = index + offset;
+                    (grid[next] != '#') && (dist[next] > numSteps)) {
+                    dist[next] = numSteps;
+                    frontier.push(next);
                 }
             }
         }
@@ -97,17 +83,17 @@ std::vector<std::array<std::int64_t, 2>> makeWindow(std::int64_t stride)
 {
     std::vector<std::array<std::int64_t, 2>> pFrontier, nFrontier, window;
     nFrontier.push_back({ 0, 0 });
-    std::vector<std::vector<bool>> visited(2*stride+1,
-                                           std::vector<bool>(2*stride+1));
-    visited[stride][stride] = true;
+    aoc::BitGrid visited(2*stride+1, 2*stride+1, false, 0);
+    visited.set(visited.index(stride, stride));
     for (std::int64_t numSteps = 1; numSteps <= stride; ++numSteps) {
         nFrontier.swap(pFrontier);
         nFrontier.clear();
         for (const auto [pI, pJ] : pFrontier) {
             for (int d = 0; d < 4; ++d) {
-                if (const auto nI = pI+Dir[d], nJ = pJ+Dir[d+1]; 
-                    !visited[stride+nI][stride+nJ]) {
-                    visited[stride+nI][stride+nJ] = true;
+                const auto nI = pI+Dir[d], nJ = pJ+Dir[d+1];
+                if (const Index cell = visited.index(stride+nI, stride+nJ);
+                    !visited.test(cell)) {
+                    visited.set(cell);
                     nFrontier.push_back({ nI, nJ });
                 }
             }
@@ -118,34 +104,41 @@ std::vector<std::array<std::int64_t, 2>> makeWindow(std::int64_t stride)
 }
 
 
-std::int64_t solve(std::int64_t                    threshold,
-                   std::int64_t                    cheatStride,
-                   const std::vector<std::string>& grid,
-                   bool                            debug = false)
+std::int64_t solve(std::int64_t           threshold,
+                   std::int64_t           cheatStride,
+                   const aoc::Grid<char>& grid,
+                   bool                   debug = false)
 {
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    const auto start = findToken(grid, 'S'), end = findToken(grid, 'E');
+    assert(cheatStride <= grid.padding());
+    const Index start = grid.find('S'), end = grid.find('E');
+    assert((start >= 0) && (end >= 0));
     const auto fromStart = bfs(grid, start), fromEnd = bfs(grid, end);
-    assert(fromStart[end[0]][end[1]] == fromEnd[start[0]][start[1]]);
-    const std::int64_t cutoff = fromStart[end[0]][end[1]] - threshold;
-    const auto window = makeWindow(cheatStride);
+    assert(fromStart[end] == fromEnd[start]);
+    const std::int64_t cutoff = fromStart[end] - threshold;
+
+    // The window as (offset, number of steps) pairs.  The border is at least
+    // 'cheatStride' wide, so every offset stays inside the grid.
+    std::vector<std::array<std::int64_t, 2>> window;
+    for (const auto [di, dj] : makeWindow(cheatStride))
+        window.push_back({ di*grid.stride() + dj,
+                           std::abs(di) + std::abs(dj) });
+
     std::int64_t total = 0;
-    for (std::int64_t i = 0; i < m; ++i) {
-        for (std::int64_t j = 0; j < n; ++j) {
-            if (grid[i][j] == '#')
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        for (Index j = 0; j < grid.numCols(); ++j) {
+            const Index index = grid.index(i, j);
+            if (grid[index] == '#')
                 continue;
 
             if (debug)
                 std::cout << '(' << i << ',' << j << ')' << std::endl;
 
-            for (const auto [di, dj] : window) {
-                const auto nI = i+di, nJ = j+dj;
-                if ((nI < 0) || (nI >= m) || (nJ < 0) || (nJ >= n) ||
-                    (grid[nI][nJ] == '#'))
+            for (const auto [offset, numSteps] : window) {
+                const Index next = index + offset;
+                if (grid[next] == '#')
                     continue;
 
-                const auto numSteps = std::abs(di) + std::abs(dj);
-                const auto dist = fromStart[i][j] + numSteps + fromEnd[nI][nJ];
+                const auto dist = fromStart[index] + numSteps + fromEnd[next];
                 total += (dist <= cutoff);
             }
         }
@@ -159,15 +152,17 @@ void check(int                     lineNumber,
            std::int64_t            cheatStride,
            const std::string_view& input)
 {
-    const std::int64_t numCheats = solve(threshold,
-                                         cheatStride,
-                                         getInput(input));
-    if (numCheats != expectedNumCheats) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumCheats
-                  << "\n> actual:   " << numCheats
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numCheats = solve(threshold,
+                                             cheatStride,
+                                             getInput(input));
+        if (numCheats != expectedNumCheats) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumCheats
+                                  << "\n> actual:   " << numCheats
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -200,11 +195,11 @@ void runTests()
         check(__LINE__, c, t, 20, grid);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numCheats = solve(100, 20, getInput());
-    std::cout << numCheats << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(100, 20, input); });
 }
@@ -4,20 +4,23 @@
 #include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <limits>
 #include <numeric>
 #include <optional>
 #include <queue>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 // Numeric Keypad
 //..
 //  +---+---+---+
@@ -258,8 +261,7 @@ struct State {
     auto operator<=>(const State&) const = default;
 };
 
-template<>
-struct std::hash<State>
+struct StateHash
 {
     std::size_t operator()(const State& s) const noexcept
     {
@@ -285,30 +287,32 @@ auto getInput(std::istream& stream)
     const auto grid = getLines(stream);
     assert(!grid.empty());
     const auto numCols = grid.empty() ? 0 : grid[0].size();
-    const bool isGrid = std::all_of(grid.begin(), grid.end(),
-                                    [=](const std::string& row) {
-                                        return row.size() == numCols;
-                                    });
+    [[maybe_unused]] const bool isGrid =
+                                  std::all_of(grid.begin(), grid.end(),
+                                              [=](const std::string& row) {
+                                                  return row.size() == numCols;
+                                              });
     assert(isGrid);
     return grid;
 }
 
 auto getInput()
 {
-    std::ifstream stream("day_21-keypad_conundrum-input.txt");
+    const aoc::MappedFile file("day_21-keypad_conundrum-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
 std::int64_t minNumPresses(const std::string_view& code)
 {
     std::queue<State>         frontier;
-    std::unordered_set<State> visited;
+    std::unordered_set<State, StateHash> visited;
     frontier.emplace(code);
     visited.emplace(code);
     for (std::size_t numPresses = 0; ; ++numPresses) {
@@ -333,8 +337,8 @@ std::int64_t getNumericPart(const std::string_view& code)
     assert(code.back() == 'A');
 
     std::int64_t numericPart;
-    const auto [_, ec] = std::from_chars(code.data(), code.data()+code.size(),
-                                         numericPart);
+    [[maybe_unused]] const auto [_, ec] =
+        std::from_chars(code.data(), code.data()+code.size(), numericPart);
     assert(ec == std::errc());
     return numericPart;
 }
@@ -352,39 +356,45 @@ void checkMinNumPresses(int                     lineNumber,
                         std::int64_t            expectedNumPresses,
                         const std::string_view& code)
 {
-    const std::int64_t numPresses = minNumPresses(code);
-    if (numPresses != expectedNumPresses) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumPresses
-                  << "\n> actual:   " << numPresses
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numPresses = minNumPresses(code);
+        if (numPresses != expectedNumPresses) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumPresses
+                                  << "\n> actual:   " << numPresses
+                                  << std::endl;
+        }
+    });
 }
 
 void checkNumericPart(int                     lineNumber,
                       std::int64_t            expectedNumericPart,
                       const std::string_view& code)
 {
-    const std::int64_t numericPart = getNumericPart(code);
-    if (numericPart != expectedNumericPart) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumericPart
-                  << "\n> actual:   " << numericPart
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numericPart = getNumericPart(code);
+        if (numericPart != expectedNumericPart) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumericPart
+                                  << "\n> actual:   " << numericPart
+                                  << std::endl;
+        }
+    });
 }
 
 void check(int                     lineNumber,
            std::int64_t            expectedComplexity,
            const std::string_view& input)
 {
-    const std::int64_t complexity = solve(getInput(input));
-    if (complexity != expectedComplexity) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedComplexity
-                  << "\n> actual:   " << complexity
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t complexity = solve(getInput(input));
+        if (complexity != expectedComplexity) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedComplexity
+                                  << "\n> actual:   " << complexity
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -416,11 +426,11 @@ void runTests()
           "379A\n");
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto complexity = solve(getInput());
-    std::cout << complexity << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
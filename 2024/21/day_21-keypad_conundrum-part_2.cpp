@@ -1,23 +1,27 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
-#include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <optional>
-#include <queue>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/embedded_input.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getLines(std::istream& stream)
 {
     std::vector<std::string> lines;
@@ -42,13 +46,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_21-keypad_conundrum-input.txt");
+    const aoc::MappedFile file("day_21-keypad_conundrum-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -88,7 +93,7 @@ auto getInput(const std::string_view& input)
 constexpr std::string_view k_DirKeys("A<>^v");
 constexpr std::string_view k_NumKeys("A0123456789");
 
-bool isValidDirKey(char dirKey)
+constexpr bool isValidDirKey(char dirKey)
 {
     switch (dirKey) {
         case 'A':
@@ -100,7 +105,7 @@ bool isValidDirKey(char dirKey)
     }
 }
 
-std::size_t indexForDirKey(char dirKey)
+constexpr std::size_t indexForDirKey(char dirKey)
 {
     assert(isValidDirKey(dirKey));
 
@@ -109,7 +114,7 @@ std::size_t indexForDirKey(char dirKey)
     return index;
 }
 
-std::array<int, 2> dirForDirKey(char dirKey)
+constexpr std::array<int, 2> dirForDirKey(char dirKey)
 {
     assert(isValidDirKey(dirKey));
 
@@ -123,7 +128,7 @@ std::array<int, 2> dirForDirKey(char dirKey)
     std::unreachable();
 }
 
-bool isValidNumKey(char numKey)
+constexpr bool isValidNumKey(char numKey)
 {
     switch (numKey) {
         case 'A':
@@ -141,7 +146,7 @@ bool isValidNumKey(char numKey)
     }
 }
 
-std::size_t indexForNumKey(char numKey)
+constexpr std::size_t indexForNumKey(char numKey)
 {
     assert(isValidNumKey(numKey));
 
@@ -150,7 +155,7 @@ std::size_t indexForNumKey(char numKey)
     return index;
 }
 
-std::array<int, 2> coordsForNumKey(char numKey)
+constexpr std::array<int, 2> coordsForNumKey(char numKey)
 {
     assert(isValidNumKey(numKey));
 
@@ -171,7 +176,7 @@ std::array<int, 2> coordsForNumKey(char numKey)
     std::unreachable();
 }
 
-std::optional<char> numKeyForCoords(const std::array<int, 2>& c)
+constexpr std::optional<char> numKeyForCoords(const std::array<int, 2>& c)
 {
     switch (c[0]) {
     case 0:
@@ -208,7 +213,7 @@ std::optional<char> numKeyForCoords(const std::array<int, 2>& c)
 
 typedef std::array<std::array<std::int64_t, 5>, 5> DirCostTable;
 
-DirCostTable makeDirCostTable(std::size_t numRobots)
+constexpr DirCostTable makeDirCostTable(std::size_t numRobots)
 {
     DirCostTable pDC, nDC;
     for (std::size_t i = 0; i < nDC.size(); ++i)
@@ -261,12 +266,34 @@ DirCostTable makeDirCostTable(std::size_t numRobots)
     return nDC;
 }
 
-std::int64_t minNumPresses(const DirCostTable& dirCost,
-                           char                start,
-                           char                finish)
+// The tables for up to 25 intermediate robots, which depend on no input and so
+// are built by the compiler.
+constexpr std::array<DirCostTable, 26> k_DirCostTables = [] {
+    std::array<DirCostTable, 26> tables;
+    for (std::size_t n = 0; n < tables.size(); ++n)
+        tables[n] = makeDirCostTable(n);
+    return tables;
+}();
+
+// Return the table for 'numRobots' intermediate robots.
+constexpr const DirCostTable& dirCostTable(std::size_t numRobots)
+{
+    assert(numRobots < k_DirCostTables.size());
+    return k_DirCostTables[numRobots];
+}
+
+constexpr std::int64_t minNumPresses(const DirCostTable& dirCost,
+                                     char                start,
+                                     char                finish)
 {
+    // A min-heap on a plain vector, as 'std::priority_queue' is not usable in
+    // constant expressions.
     typedef std::tuple<std::int64_t, char, char> State;
-    std::priority_queue<State, std::vector<State>, std::greater<State>> nState;
+    std::vector<State> nState;
+    const auto push = [&](std::int64_t cost, char num, char dir) {
+        nState.emplace_back(cost, num, dir);
+        std::push_heap(nState.begin(), nState.end(), std::greater<State>());
+    };
     std::array<std::array<std::int64_t, 5>, 11> minCosts;
     for (auto& row : minCosts)
         row.fill(std::numeric_limits<std::int64_t>::max());
@@ -278,11 +305,12 @@ std::int64_t minNumPresses(const DirCostTable& dirCost,
         return minCosts[indexForNumKey(numKey)][indexForDirKey(dirKey)];
     };
     minCostFor(start, 'A') = 0;
-    nState.emplace(0, start, 'A');
+    push(0, start, 'A');
     std::int64_t minCost = std::numeric_limits<std::int64_t>::max();
     while (!nState.empty()) {
-        const auto [pCost, pNum, pDir] = nState.top();
-        nState.pop();
+        std::pop_heap(nState.begin(), nState.end(), std::greater<State>());
+        const auto [pCost, pNum, pDir] = nState.back();
+        nState.pop_back();
         if (pNum == finish) {
             minCost = std::min(minCost, pCost + movePressCost(pDir, 'A'));
             continue;
@@ -295,7 +323,7 @@ std::int64_t minNumPresses(const DirCostTable& dirCost,
                 auto& nMinCost = minCostFor(*nNum, nDir);
                 if (nCost < nMinCost) {
                     nMinCost = nCost;
-                    nState.emplace(nCost, *nNum, nDir);
+                    push(nCost, *nNum, nDir);
                 }
             }
         }
@@ -303,11 +331,11 @@ std::int64_t minNumPresses(const DirCostTable& dirCost,
     return minCost;
 }
 
-std::int64_t minNumPresses(const std::string_view& code,
-                           std::size_t             numRobots)
+constexpr std::int64_t minNumPresses(const std::string_view& code,
+                                     std::size_t             numRobots)
 {
     std::int64_t numPresses = 0;
-    const auto dirCost = makeDirCostTable(numRobots);
+    const DirCostTable& dirCost = dirCostTable(numRobots);
     char pNum = 'A';
     for (const char nNum : code) {
         numPresses += minNumPresses(dirCost, pNum, nNum);
@@ -316,66 +344,88 @@ std::int64_t minNumPresses(const std::string_view& code,
     return numPresses;
 }
 
-std::int64_t getNumericPart(const std::string_view& code)
+constexpr std::int64_t getNumericPart(const std::string_view& code)
 {
     assert(code.size() > 1);
     assert(code.back() == 'A');
 
-    std::int64_t numericPart;
-    const auto [_, ec] = std::from_chars(code.data(), code.data()+code.size(),
-                                         numericPart);
-    assert(ec == std::errc());
+    // By hand, as 'std::from_chars' is not usable in constant expressions.
+    std::int64_t numericPart = 0;
+    for (const char digit : code.substr(0, code.size()-1)) {
+        assert(digit >= '0' && digit <= '9');
+        numericPart = 10 * numericPart + (digit - '0');
+    }
     return numericPart;
 }
 
-std::int64_t solve(const std::vector<std::string>& codes,
-                   std::size_t                     numRobots)
+// Return the total complexity of 'codes', a range of strings.
+template <class CODES>
+constexpr std::int64_t solve(const CODES& codes, std::size_t numRobots)
 {
 
     return std::transform_reduce(
-        codes.begin(), codes.end(), 0LL, std::plus{},
-        [=](const std::string& code) {
+        std::begin(codes), std::end(codes), 0LL, std::plus{},
+        [=](std::string_view code) {
             return minNumPresses(code, numRobots) * getNumericPart(code);
         });
 }
 
+// The codes of the 'aoc::embeddedInput()', split by the compiler into an
+// array of exactly their number, and the answer for them.
+constexpr std::size_t k_NumEmbeddedCodes =
+                          std::ranges::distance(aoc::lines(aoc::embeddedInput()));
+
+constexpr auto k_EmbeddedCodes = [] {
+    std::array<std::string_view, k_NumEmbeddedCodes> codes;
+    std::ranges::copy(aoc::lines(aoc::embeddedInput()), codes.begin());
+    return codes;
+}();
+
+constexpr std::int64_t k_EmbeddedAnswer = solve(k_EmbeddedCodes, 25);
+
 void checkMinNumPresses(int                     lineNumber,
                         std::int64_t            expectedNumPresses,
                         const std::string_view& code)
 {
-    const std::int64_t numPresses = minNumPresses(code, 2);
-    if (numPresses != expectedNumPresses) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumPresses
-                  << "\n> actual:   " << numPresses
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numPresses = minNumPresses(code, 2);
+        if (numPresses != expectedNumPresses) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumPresses
+                                  << "\n> actual:   " << numPresses
+                                  << std::endl;
+        }
+    });
 }
 
 void checkNumericPart(int                     lineNumber,
                       std::int64_t            expectedNumericPart,
                       const std::string_view& code)
 {
-    const std::int64_t numericPart = getNumericPart(code);
-    if (numericPart != expectedNumericPart) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumericPart
-                  << "\n> actual:   " << numericPart
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t numericPart = getNumericPart(code);
+        if (numericPart != expectedNumericPart) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumericPart
+                                  << "\n> actual:   " << numericPart
+                                  << std::endl;
+        }
+    });
 }
 
 void check(int                     lineNumber,
            std::int64_t            expectedComplexity,
            const std::string_view& input)
 {
-    const std::int64_t complexity = solve(getInput(input), 2);
-    if (complexity != expectedComplexity) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedComplexity
-                  << "\n> actual:   " << complexity
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const std::int64_t complexity = solve(getInput(input), 2);
+        if (complexity != expectedComplexity) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedComplexity
+                                  << "\n> actual:   " << complexity
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -413,12 +463,12 @@ void runTests()
           "682A\n");
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
     // 347775748043170: TOO HIGH
-    const auto complexity = solve(getInput(), 25);
-    std::cout << complexity << std::endl;
-    return 0;
+    return aoc::runEmbedded(argc, argv, "1", k_EmbeddedAnswer,
+                            [] { return getInput(); },
+                            [](const auto& input) { return solve(input, 25); });
 }
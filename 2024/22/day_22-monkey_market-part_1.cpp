@@ -1,19 +1,24 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <numeric>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::int64_t> secretNumbers;
@@ -25,16 +30,28 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_22-monkey_market-input.txt");
+    const aoc::MappedFile file("day_22-monkey_market-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
+std::int64_t parseSecretNumber(std::string_view line)
+{
+    std::int64_t secretNumber = 0;
+    [[maybe_unused]] const auto [ptr, errc] =
+                                    std::from_chars(line.data(),
+                                                    line.data() + line.size(),
+                                                    secretNumber);
+    assert(errc == std::errc());
+    return secretNumber;
+}
+
 std::int64_t mix(std::int64_t lhs, std::int64_t rhs)
 {
     return lhs ^ rhs;
@@ -69,19 +86,31 @@ std::int64_t solve(const std::vector<std::int64_t>& secretNumbers,
         });
 }
 
+// Sum the secret numbers generated from those on 'lines' as they are read.
+template <class LINES>
+std::int64_t solveStreaming(LINES&& lines, std::size_t numIterations)
+{
+    std::int64_t sum = 0;
+    for (const std::string_view line : lines)
+        sum += generateSecretNumber(parseSecretNumber(line), numIterations);
+    return sum;
+}
+
 void check(int          lineNumber,
            std::int64_t expectedNewSecretNumber,
            std::size_t  numIterations,
            std::int64_t initialSecretNumber)
 {
-    const auto newSecretNumber = generateSecretNumber(initialSecretNumber,
-                                                      numIterations);
-    if (newSecretNumber != expectedNewSecretNumber) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNewSecretNumber
-                  << "\n> actual:   " << newSecretNumber
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const auto newSecretNumber = generateSecretNumber(initialSecretNumber,
+                                                          numIterations);
+        if (newSecretNumber != expectedNewSecretNumber) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNewSecretNumber
+                                  << "\n> actual:   " << newSecretNumber
+                                  << std::endl;
+        }
+    });
 }
 
 void check(int                     lineNumber,
@@ -89,13 +118,23 @@ void check(int                     lineNumber,
            std::size_t             numIterations,
            const std::string_view& input)
 {
-    const auto sum = solve(getInput(input), numIterations);
-    if (sum != expectedSum) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedSum
-                  << "\n> actual:   " << sum
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const auto sum = solve(getInput(input), numIterations);
+        if (sum != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedSum
+                                  << "\n> actual:   " << sum
+                                  << std::endl;
+        }
+        const auto streamedSum = solveStreaming(aoc::lines(input),
+                                                numIterations);
+        if (streamedSum != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << ", streaming):"
+                                  << "\n> expected: " << expectedSum
+                                  << "\n> actual:   " << streamedSum
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -118,11 +157,16 @@ void runTests()
           "2024\n");
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto sum = solve(getInput(), 2000);
-    std::cout << sum << std::endl;
-    return 0;
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& input) { return solve(input, 2000); },
+        [] {
+            return solveStreaming(
+                       aoc::LineReader("day_22-monkey_market-input.txt"), 2000);
+        });
 }
@@ -2,21 +2,26 @@
 #include <array>
 #include <bitset>
 #include <cassert>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <numeric>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::int64_t> secretNumbers;
@@ -28,16 +33,28 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_22-monkey_market-input.txt");
+    const aoc::MappedFile file("day_22-monkey_market-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
+std::int64_t parseSecretNumber(std::string_view line)
+{
+    std::int64_t secretNumber = 0;
+    [[maybe_unused]] const auto [ptr, errc] =
+                                    std::from_chars(line.data(),
+                                                    line.data() + line.size(),
+                                                    secretNumber);
+    assert(errc == std::errc());
+    return secretNumber;
+}
+
 std::int64_t mix(std::int64_t lhs, std::int64_t rhs)
 {
     return lhs ^ rhs;
@@ -120,18 +137,32 @@ std::int64_t solve(const std::vector<std::int64_t>& secretNumbers,
     return *std::max_element(seqCountSums.begin(), seqCountSums.end());
 }
 
+// Return the most bananas to be had from the buyers whose initial secret
+// numbers are on 'lines', folding in each buyer as it is read.
+template <class LINES>
+std::int64_t solveStreaming(LINES&& lines, std::size_t numSecretNumbers)
+{
+    SeqCounter seqCountSums{};
+    for (const std::string_view line : lines)
+        addBananas(seqCountSums, parseSecretNumber(line), numSecretNumbers);
+
+    return *std::max_element(seqCountSums.begin(), seqCountSums.end());
+}
+
 void check(int                              lineNumber,
            std::int64_t                     expectedMaxBananas,
            std::size_t                      numSecretNumbers,
            const std::vector<std::int64_t>& secretNumbers)
 {
-    const auto maxBananas = solve(secretNumbers, numSecretNumbers);
-    if (maxBananas != expectedMaxBananas) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedMaxBananas
-                  << "\n> actual:   " << maxBananas
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        const auto maxBananas = solve(secretNumbers, numSecretNumbers);
+        if (maxBananas != expectedMaxBananas) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedMaxBananas
+                                  << "\n> actual:   " << maxBananas
+                                  << std::endl;
+        }
+    });
 }
 
 void check(int                     lineNumber,
@@ -139,10 +170,17 @@ void check(int                     lineNumber,
            std::size_t             numSecretNumbers,
            const std::string_view& input)
 {
-    return check(lineNumber,
-                 expectedMaxBananas,
-                 numSecretNumbers,
-                 getInput(input));
+    check(lineNumber, expectedMaxBananas, numSecretNumbers, getInput(input));
+    aoc::addCheck(lineNumber, [=] {
+        const auto maxBananas = solveStreaming(aoc::lines(input),
+                                               numSecretNumbers);
+        if (maxBananas != expectedMaxBananas) {
+            *aoc::failureStream() << "failure(" << lineNumber << ", streaming):"
+                                  << "\n> expected: " << expectedMaxBananas
+                                  << "\n> actual:   " << maxBananas
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -157,11 +195,16 @@ void runTests()
     check(__LINE__, 1701, 2000, getInput());
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto sum = solve(getInput(), 2000);
-    std::cout << sum << std::endl;
-    return 0;
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& input) { return solve(input, 2000); },
+        [] {
+            return solveStreaming(
+                       aoc::LineReader("day_22-monkey_market-input.txt"), 2000);
+        });
 }
@@ -3,16 +3,19 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <iterator>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::pair<std::string, std::string>> edges;
@@ -26,13 +29,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_23-lan_party-input.txt");
+    const aoc::MappedFile file("day_23-lan_party-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -117,27 +121,31 @@ void check(int                     lineNumber,
            const std::string_view& expectedSets,
            const std::string_view& source)
 {
-    std::string sets, matchSets;
-    if (const auto numMatchSets = solve(getInput(source), 3, 't',
-                                        &sets, &matchSets);
-        numMatchSets != expectedNumMatchSets) {
-        std::cerr << "failure(" << lineNumber << ") - num match sets:"
-                  << "\n> expected: " << expectedNumMatchSets
-                  << "\n> actual:   " << numMatchSets
-                  << std::endl;
-    }
-    if (matchSets != expectedMatchSets) {
-        std::cerr << "failure(" << lineNumber << ") - match sets:"
-                  << "\n> expected: " << expectedMatchSets
-                  << "\n> actual:   " << matchSets
-                  << std::endl;
-    }
-    if (sets != expectedSets) {
-        std::cerr << "failure(" << lineNumber << ") - sets:"
-                  << "\n> expected: " << expectedSets
-                  << "\n> actual:   " << sets
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        std::string sets, matchSets;
+        if (const auto numMatchSets = solve(getInput(source), 3, 't',
+                                            &sets, &matchSets);
+            numMatchSets != expectedNumMatchSets) {
+            *aoc::failureStream()
+                << "failure(" << lineNumber << ") - num match sets:"
+                << "\n> expected: " << expectedNumMatchSets
+                << "\n> actual:   " << numMatchSets
+                << std::endl;
+        }
+        if (matchSets != expectedMatchSets) {
+            *aoc::failureStream()
+                << "failure(" << lineNumber << ") - match sets:"
+                << "\n> expected: " << expectedMatchSets
+                << "\n> actual:   " << matchSets
+                << std::endl;
+        }
+        if (sets != expectedSets) {
+            *aoc::failureStream() << "failure(" << lineNumber << ") - sets:"
+                                  << "\n> expected: " << expectedSets
+                                  << "\n> actual:   " << sets
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -197,11 +205,11 @@ void runTests()
           "td-yn\n");
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numSets = solve(getInput(), 3, 't');
-    std::cout << numSets << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input, 3, 't'); });
 }
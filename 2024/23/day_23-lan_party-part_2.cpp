@@ -3,18 +3,21 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <map>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::pair<std::string, std::string>> edges;
@@ -28,13 +31,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_23-lan_party-input.txt");
+    const aoc::MappedFile file("day_23-lan_party-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -133,13 +137,15 @@ void check(int                     lineNumber,
            const std::string_view& expectedPassword,
            const std::string_view& source)
 {
-    if (const auto password = solve(getInput(source));
-        password != expectedPassword) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedPassword
-                  << "\n> actual:   " << password
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto password = solve(getInput(source));
+            password != expectedPassword) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedPassword
+                                  << "\n> actual:   " << password
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -180,11 +186,11 @@ void runTests()
           "td-yn\n");
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto password = solve(getInput());
-    std::cout << password << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
@@ -3,11 +3,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <limits>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -15,6 +14,10 @@
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 enum State : std::uint8_t {
     e_Unset = 255,
     e_Off   = 0,
@@ -110,20 +113,22 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_24-crossed_wires-input.txt");
+    const aoc::MappedFile file("day_24-crossed_wires-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
 std::uint64_t makeNumber(const std::vector<std::string>& wires,
                          const std::vector<State>&       states)
 {
-    std::uint64_t num = 0, numOutputs = 0;
+    std::uint64_t num = 0;
+    [[maybe_unused]] std::uint64_t numOutputs = 0;
     for (const auto& [wire, state] : std::views::zip(wires, states)
                                    | std::views::reverse) {
         assert(state != e_Unset);
@@ -209,20 +214,22 @@ void check(int                     lineNumber,
            const std::string_view& expectedStates,
            const std::string_view& source)
 {
-    std::string states;
-    if (const auto num = solve(getInput(source), &states);
-        num != expectedNum) {
-        std::cerr << "failure(" << lineNumber << ") - num:"
-                  << "\n> expected: " << expectedNum
-                  << "\n> actual:   " << num
-                  << std::endl;
-    }
-    if (states != expectedStates) {
-        std::cerr << "failure(" << lineNumber << ") - states:"
-                  << "\n> expected:\n" << expectedStates
-                  << "\n> actual:\n" << states
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        std::string states;
+        if (const auto num = solve(getInput(source), &states);
+            num != expectedNum) {
+            *aoc::failureStream() << "failure(" << lineNumber << ") - num:"
+                                  << "\n> expected: " << expectedNum
+                                  << "\n> actual:   " << num
+                                  << std::endl;
+        }
+        if (states != expectedStates) {
+            *aoc::failureStream() << "failure(" << lineNumber << ") - states:"
+                                  << "\n> expected:\n" << expectedStates
+                                  << "\n> actual:\n" << states
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -349,12 +356,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    std::string states;
-    const auto num = solve(getInput(), &states);
-    std::cout << num << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
@@ -3,11 +3,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <limits>
 #include <ranges>
-#include <sstream>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -15,6 +14,9 @@
 #include <utility>
 #include <vector>
 
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 enum State : std::uint8_t {
     e_Unset = 255,
     e_Off   = 0,
@@ -122,13 +124,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_24-crossed_wires-input.txt");
+    const aoc::MappedFile file("day_24-crossed_wires-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -413,9 +416,9 @@ std::string solve(const Input& input, std::uint16_t numSwaps, bool debug=false)
     return swaps;
 }
 
-int main()
+int main(int argc, char *argv[])
 {
-    const auto num = solve(getInput(), 4);
-    std::cout << num << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input, 4); });
 }
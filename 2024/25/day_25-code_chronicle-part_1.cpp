@@ -3,87 +3,133 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
-#include <limits>
-#include <ranges>
-#include <sstream>
+#include <span>
 #include <string>
 #include <string_view>
-#include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/embedded_input.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Heights = std::array<std::int8_t, 5>;
+
 struct Input {
-    std::vector<std::array<std::int8_t, 5>> d_keys;
-    std::vector<std::array<std::int8_t, 5>> d_locks;
+    std::vector<Heights> d_keys;
+    std::vector<Heights> d_locks;
 };
 
-auto getInput(std::istream& stream)
+// Call 'visit(isKey, heights)' for each schematic in 'source', in order.
+// Usable in constant expressions.
+template <class VISITOR>
+constexpr void forEachSchematic(std::string_view source, VISITOR&& visit)
 {
-    Input input;
-    const auto isMatch = [](const std::string& line, char token) { 
-        return std::all_of(line.begin(), line.end(),
-                           [=](char cell) { return cell == token; });
+    const auto isMatch = [](std::string_view line, char token) {
+        return line.find_first_not_of(token) == std::string_view::npos;
     };
-    for (std::string line; std::getline(stream, line); ) {
-        const auto [heightToken, obj] =
-              isMatch(line, '.')
-            ? std::make_pair('.', &input.d_keys.emplace_back())
-            : isMatch(line, '#')
-            ? std::make_pair('#', &input.d_locks.emplace_back())
-            : std::make_pair('X', nullptr);
-        assert(obj);
-        while (std::getline(stream, line) && !line.empty())
-            for (const auto& [token, counter] : std::views::zip(line, *obj))
-                counter += (token == heightToken);
+    const aoc::Lines lines(source);
+    for (auto it = lines.begin(); it != lines.end(); ) {
+        const std::string_view top = *it;
+        const bool isKey = isMatch(top, '.');
+        assert(isKey || isMatch(top, '#'));
+        const char heightToken = isKey ? '.' : '#';
+
+        Heights heights = {};
+        for (++it; it != lines.end() && !(*it).empty(); ++it) {
+            const std::string_view line = *it;
+            assert(line.size() == heights.size());
+            for (std::size_t i = 0; i < heights.size(); ++i)
+                heights[i] += (line[i] == heightToken);
+        }
+        if (it != lines.end())
+            ++it;
+        visit(isKey, heights);
     }
-    return input;
 }
 
-auto getInput()
+auto getInput(std::string_view source)
 {
-    std::ifstream stream("day_25-code_chronicle-input.txt");
-    return getInput(stream);
+    Input input;
+    forEachSchematic(source, [&](bool isKey, const Heights& heights) {
+        (isKey ? input.d_keys : input.d_locks).push_back(heights);
+    });
+    return input;
 }
 
-auto getInput(const std::string_view& input)
+auto getInput()
 {
-    std::istringstream stream{std::string(input)};
-    return getInput(stream);
+    const aoc::MappedFile file("day_25-code_chronicle-input.txt");
+    return getInput(file.view());
 }
 
-bool haveFit(const std::array<std::int8_t, 5>& key,
-             const std::array<std::int8_t, 5>& lock)
+constexpr bool haveFit(const Heights& key, const Heights& lock)
 {
-    return std::ranges::all_of(std::views::zip(key, lock), [](const auto& p) {
-        const auto [k, l] = p;
-        return k >= l;
-    });
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        if (key[i] < lock[i])
+            return false;
+    }
+    return true;
 }
 
-std::uint64_t solve(const Input& input)
+constexpr std::uint64_t solve(std::span<const Heights> keys,
+                              std::span<const Heights> locks)
 {
     std::uint64_t numPairs = 0;
-    for (const auto& key : input.d_keys)
-        for (const auto& lock : input.d_locks)
+    for (const auto& key : keys)
+        for (const auto& lock : locks)
             numPairs += haveFit(key, lock);
 
     return numPairs;
 }
 
+std::uint64_t solve(const Input& input)
+{
+    return solve(input.d_keys, input.d_locks);
+}
+
+// The keys and locks of the 'aoc::embeddedInput()', parsed by the compiler
+// into arrays of exactly their number, and the answer for them.
+constexpr std::array<std::size_t, 2> k_NumEmbedded = [] {
+    std::array<std::size_t, 2> counts = {};
+    forEachSchematic(aoc::embeddedInput(), [&](bool isKey, const Heights&) {
+        ++counts[isKey ? 0 : 1];
+    });
+    return counts;
+}();
+
+constexpr auto k_EmbeddedSchematics = [] {
+    std::pair<std::array<Heights, k_NumEmbedded[0]>,
+              std::array<Heights, k_NumEmbedded[1]>> schematics = {};
+    std::size_t numKeys = 0, numLocks = 0;
+    forEachSchematic(aoc::embeddedInput(),
+                     [&](bool isKey, const Heights& heights) {
+        if (isKey)
+            schematics.first[numKeys++] = heights;
+        else
+            schematics.second[numLocks++] = heights;
+    });
+    return schematics;
+}();
+
+constexpr std::uint64_t k_EmbeddedAnswer = solve(k_EmbeddedSchematics.first,
+                                                 k_EmbeddedSchematics.second);
+
 void check(int                     lineNumber,
            std::uint64_t           expectedNumPairs,
            const std::string_view& source)
 {
-    if (const auto numPairs = solve(getInput(source));
-        numPairs != expectedNumPairs) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedNumPairs
-                  << "\n> actual:   " << numPairs
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto numPairs = solve(getInput(source));
+            numPairs != expectedNumPairs) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedNumPairs
+                                  << "\n> actual:   " << numPairs
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -133,11 +179,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numPairs = solve(getInput());
-    std::cout << numPairs << std::endl;
-    return 0;
+    return aoc::runEmbedded(argc, argv, "1", k_EmbeddedAnswer,
+                            [] { return getInput(); },
+                            [](const auto& input) { return solve(input); });
 }
@@ -1,49 +1,61 @@
 #include <cassert>
 #include <charconv>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
+#include <ranges>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+std::int64_t parseRotation(std::string_view line)
+{
+    assert(line.size() >= 2);
+    std::int64_t rotation = 0;
+    [[maybe_unused]] const auto [_ptr, err] =
+                            std::from_chars(line.data()+1,
+                                            line.data()+line.size(),
+                                            rotation);
+    assert(err == std::errc());
+    switch (line[0]) {
+        case 'L':
+            return -rotation;
+        case 'R':
+            return rotation;
+        default:
+            std::unreachable();
+    }
+}
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::int64_t> input;
-    for (std::string line; std::getline(stream, line); ) {
-        assert(line.size() >= 2);
-        const auto [_ptr, err] = std::from_chars(line.data()+1,
-                                                 line.data()+line.size(),
-                                                 input.emplace_back());
-        assert(err == std::errc());
-        switch (line[0]) {
-            case 'L':
-                input.back() = -input.back();
-                break;
-            case 'R':
-                break;
-            default:
-                std::unreachable();
-        }
-    }
+    for (std::string line; std::getline(stream, line); )
+        input.push_back(parseRotation(line));
     return input;
 }
 
 auto getInput()
 {
-    std::ifstream stream("day_01-secret_entrance-input.txt");
+    const aoc::MappedFile file("day_01-secret_entrance-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
-std::int64_t solve(std::span<const std::int64_t> input)
+template <class ROTATIONS>
+std::int64_t solve(ROTATIONS&& input)
 {
     std::int64_t pos = 50, pass = 0;
     for (std::int64_t rot : input)
@@ -51,17 +63,33 @@ std::int64_t solve(std::span<const std::int64_t> input)
     return pass;
 }
 
+// Fold the rotations on 'lines' into the password as they are read.
+template <class LINES>
+std::int64_t solveStreaming(LINES&& lines)
+{
+    return solve(lines | std::views::transform(parseRotation));
+}
+
 void check(int                     lineNumber,
            std::int64_t            expectedPassword,
            const std::string_view& source)
 {
-    if (const auto password = solve(getInput(source));
-        password != expectedPassword) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedPassword
-                  << "\n> actual:   " << password
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto password = solve(getInput(source));
+            password != expectedPassword) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedPassword
+                                  << "\n> actual:   " << password
+                                  << std::endl;
+        }
+        if (const auto password = solveStreaming(aoc::lines(source));
+            password != expectedPassword) {
+            *aoc::failureStream() << "failure(" << lineNumber << ", streaming):"
+                                  << "\n> expected: " << expectedPassword
+                                  << "\n> actual:   " << password
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -82,11 +110,16 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto password = solve(getInput());
-    std::cout << password << std::endl;
-    return 0;
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& input) { return solve(input); },
+        [] {
+            return solveStreaming(
+                       aoc::LineReader("day_01-secret_entrance-input.txt"));
+        });
 }
@@ -3,17 +3,22 @@
 #include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
+#include <memory_resource>
 #include <numeric>
 #include <optional>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <aoc/arena.h>
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::array<std::int64_t, 2>> input;
@@ -22,13 +27,11 @@ auto getInput(std::istream& stream)
             const auto dash  = line.find('-', pos+1),
                        comma = std::min(line.size(), line.find(',', dash+1));
             auto& [first, last] = input.emplace_back();
-            const auto [_ptr1, err1] = std::from_chars(line.data()+pos,
-                                                       line.data()+dash,
-                                                       first);
+            [[maybe_unused]] const auto [_ptr1, err1] =
+                std::from_chars(line.data()+pos, line.data()+dash, first);
             assert(err1 == std::errc());
-            const auto [_ptr2, err2] = std::from_chars(line.data()+dash+1,
-                                                       line.data()+comma,
-                                                       last);
+            [[maybe_unused]] const auto [_ptr2, err2] =
+                std::from_chars(line.data()+dash+1, line.data()+comma, last);
             assert(err2 == std::errc());
             pos = comma + 1;
         }
@@ -38,13 +41,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_02-gift_shop-input.txt");
+    const aoc::MappedFile file("day_02-gift_shop-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -56,14 +60,19 @@ std::optional<std::int64_t> toInt(std::span<const char> digits)
     return (err == std::errc()) ? std::optional(x) : std::nullopt;
 }
 
-std::vector<std::int64_t> invalidsInRange(std::int64_t first,
-                                                 std::int64_t last)
+// Return the invalid IDs in '[first, last]', in increasing order, allocated
+// from 'resource' along with any temporaries.
+std::pmr::vector<std::int64_t> invalidsInRange(
+                     std::int64_t               first,
+                     std::int64_t               last,
+                     std::pmr::memory_resource *resource =
+                                             std::pmr::get_default_resource())
 {
     assert(first >= 0);
     assert(last >= 0);
     assert(first <= last);
 
-    std::unordered_set<std::int64_t> invalids;
+    std::pmr::unordered_set<std::int64_t> invalids(resource);
     for (std::int64_t x = 1; ; ++x) {
         char buffer[40];
         const auto [xEnd, err] = std::to_chars(buffer,
@@ -75,7 +84,9 @@ std::vector<std::int64_t> invalidsInRange(std::int64_t first,
             const auto num = toInt(digits);
             if (!num || (*num > last)) {
                 if (digits.size() == (2UL*(xEnd-buffer))) {
-                    std::vector result(invalids.begin(), invalids.end());
+                    std::pmr::vector<std::int64_t> result(invalids.begin(),
+                                                          invalids.end(),
+                                                          resource);
                     std::ranges::sort(result);
                     return result;
                 }
@@ -93,7 +104,8 @@ std::int64_t solve(std::span<const std::array<std::int64_t, 2>> input)
 {
     std::int64_t sumInvalids = 0;
     for (const auto [first, last] : input) {
-        const auto invalids = invalidsInRange(first, last);
+        aoc::ArenaScope scratch;
+        const auto invalids = invalidsInRange(first, last, scratch.resource());
         sumInvalids += std::reduce(invalids.begin(), invalids.end());
     }
     return sumInvalids;
@@ -113,26 +125,33 @@ void check(int                           lineNumber,
            std::int64_t                  first,
            std::int64_t                  last)
 {
-    if (const auto invalids = invalidsInRange(first, last);
-        !std::ranges::equal(expectedInvalids, invalids)) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << join(expectedInvalids)
-                  << "\n> actual:   " << join(invalids)
-                  << std::endl;
-    }
+    // 'expectedInvalids' is usually a temporary that the check outlives.
+    std::vector<std::int64_t> expected(expectedInvalids.begin(),
+                                       expectedInvalids.end());
+    aoc::addCheck(lineNumber, [=, expected = std::move(expected)] {
+        if (const auto invalids = invalidsInRange(first, last);
+            !std::ranges::equal(expected, invalids)) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << join(expected)
+                                  << "\n> actual:   " << join(invalids)
+                                  << std::endl;
+        }
+    });
 }
 
 void check(int                     lineNumber,
            std::int64_t            expectedSum,
            const std::string_view& source)
 {
-    if (const auto sumInvalids = solve(getInput(source));
-        sumInvalids != expectedSum) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedSum
-                  << "\n> actual:   " << sumInvalids
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto sumInvalids = solve(getInput(source));
+            sumInvalids != expectedSum) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedSum
+                                  << "\n> actual:   " << sumInvalids
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -157,11 +176,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto sumInvalids = solve(getInput());
-    std::cout << sumInvalids << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
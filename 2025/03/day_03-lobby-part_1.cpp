@@ -3,16 +3,20 @@
 #include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <numeric>
 #include <ranges>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::string> input;
@@ -23,13 +27,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    std::ifstream stream("day_03-lobby-input.txt");
+    const aoc::MappedFile file("day_03-lobby-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(const std::string_view& input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -47,7 +52,10 @@ std::int64_t joltageForBank(std::string_view bank)
     return maxJ;
 }
 
-std::int64_t solve(std::span<const std::string> input)
+// Sum the joltages of the banks in 'input', which may be any range of
+// lines, e.g. a 'LineReader' to fold them in as they are read.
+template <class BANKS>
+std::int64_t solve(BANKS&& input)
 {
     return std::ranges::fold_left(input |
                                   std::views::transform(joltageForBank),
@@ -59,26 +67,37 @@ void checkBank(int              lineNumber,
                std::int64_t     expectedJoltage,
                std::string_view bank)
 {
-    if (const auto joltage = joltageForBank(bank);
-        joltage != expectedJoltage) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedJoltage
-                  << "\n> actual:   " << joltage
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto joltage = joltageForBank(bank);
+            joltage != expectedJoltage) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedJoltage
+                                  << "\n> actual:   " << joltage
+                                  << std::endl;
+        }
+    });
 }
 
 void check(int                     lineNumber,
            std::int64_t            expectedTotalJoltage,
            const std::string_view& source)
 {
-    if (const auto totalJoltage = solve(getInput(source));
-        totalJoltage != expectedTotalJoltage) {
-        std::cerr << "failure(" << lineNumber << "):"
-                  << "\n> expected: " << expectedTotalJoltage
-                  << "\n> actual:   " << totalJoltage
-                  << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto totalJoltage = solve(getInput(source));
+            totalJoltage != expectedTotalJoltage) {
+            *aoc::failureStream() << "failure(" << lineNumber << "):"
+                                  << "\n> expected: " << expectedTotalJoltage
+                                  << "\n> actual:   " << totalJoltage
+                                  << std::endl;
+        }
+        if (const auto totalJoltage = solve(aoc::lines(source));
+            totalJoltage != expectedTotalJoltage) {
+            *aoc::failureStream() << "failure(" << lineNumber << ", streaming):"
+                                  << "\n> expected: " << expectedTotalJoltage
+                                  << "\n> actual:   " << totalJoltage
+                                  << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -97,11 +116,13 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto sumInvalids = solve(getInput());
-    std::cout << sumInvalids << std::endl;
-    return 0;
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& input) { return solve(input); },
+        [] { return solve(aoc::LineReader("day_03-lobby-input.txt")); });
 }
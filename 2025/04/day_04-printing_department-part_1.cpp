@@ -4,53 +4,53 @@
 #include <cstddef>
 #include <format>
 #include <cstdint>
-#include <fstream>
 #include <iostream>
 #include <numeric>
 #include <ranges>
-#include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::string> input;
     for (std::string line; std::getline(stream, line); )
         input.push_back(std::move(line));
-    return input;
+    return aoc::Grid<char>::fromRows(input, '.');
 }
 
 auto getInput()
 {
-    std::ifstream stream("day_04-printing_department-input.txt");
+    const aoc::MappedFile file("day_04-printing_department-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
-std::vector<std::string> mark(std::span<const std::string> grid)
+aoc::Grid<char> mark(const aoc::Grid<char>& grid)
 {
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    std::vector<std::string> marked(grid.begin(), grid.end());
-    for (std::int64_t ii = 0; ii < m; ++ii) {
-        for (std::int64_t jj = 0; jj < n; ++jj) {
-            if (grid[ii][jj] == '@') {
+    aoc::Grid<char> marked(grid);
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        for (Index j = 0; j < grid.numCols(); ++j) {
+            if (const Index index = grid.index(i, j); grid[index] == '@') {
                 std::int64_t cnt = 0;
-                for (std::int64_t
-                     iMin = std::max(0L, ii-1), iMax = std::min(n-1, ii+1),
-                     jMin = std::max(0L, jj-1), jMax = std::min(n-1, jj+1),
-                     i = iMin; i <= iMax; ++i)
-                    for (std::int64_t j = jMin; j <= jMax; ++j)
-                        if (((i != ii) || (j != jj)) && (grid[i][j] == '@') &&
-                            (++cnt >= 4))
-                            goto nextRoll;
-                marked[ii][jj] = 'x';
+                for (const Index offset : grid.neighbors8())
+                    if ((grid[index + offset] == '@') && (++cnt >= 4))
+                        goto nextRoll;
+                marked[index] = 'x';
                 nextRoll: ;
             }
         }
@@ -58,15 +58,17 @@ std::vector<std::string> mark(std::span<const std::string> grid)
     return marked;
 }
 
-std::string joinLines(std::span<const std::string> lines)
+std::string joinLines(const aoc::Grid<char>& grid)
 {
     std::string result;
-    for (const std::string& line : lines)
-        result += line, result += '\n';
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        const auto row = grid.rowCells(i);
+        result.append(row.begin(), row.end()), result += '\n';
+    }
     return result;
 }
 
-std::int64_t solve(std::span<const std::string> input)
+std::int64_t solve(const aoc::Grid<char>& input)
 {
     return std::ranges::count(joinLines(mark(input)), 'x');
 }
@@ -75,24 +77,28 @@ void check(int              lineNumber,
            std::string_view expectedMarks,
            std::string_view source)
 {
-    if (const auto marks = joinLines(mark(getInput(source)));
-        marks != expectedMarks) {
-        std::cerr
-            << std::format("failure({}):\n> expected:\n{}\n> actual:\n{}\n",
-                           lineNumber, expectedMarks, marks)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto marks = joinLines(mark(getInput(source)));
+            marks != expectedMarks) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected:\n{}\n> actual:\n{}\n",
+                               lineNumber, expectedMarks, marks)
+                << std::endl;
+        }
+    });
 }
 
 void check(int lineNumber, std::int64_t expectedRolls, std::string_view source)
 {
-    if (const auto numRolls = solve(getInput(source));
-        numRolls != expectedRolls) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}, \n> actual:   {}\n",
-                           lineNumber, expectedRolls, numRolls)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto numRolls = solve(getInput(source));
+            numRolls != expectedRolls) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}, \n> actual:   {}\n",
+                               lineNumber, expectedRolls, numRolls)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -136,11 +142,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto sumInvalids = solve(getInput());
-    std::cout << sumInvalids << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
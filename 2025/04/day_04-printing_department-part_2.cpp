@@ -4,83 +4,80 @@
 #include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <numeric>
 #include <queue>
 #include <ranges>
-#include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
+using Index = aoc::GridShape::Index;
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::string> input;
     for (std::string line; std::getline(stream, line); )
         input.push_back(std::move(line));
-    return input;
+    return aoc::Grid<char>::fromRows(input, '.');
 }
 
 auto getInput()
 {
-    std::ifstream stream("day_04-printing_department-input.txt");
+    const aoc::MappedFile file("day_04-printing_department-input.txt");
+    std::ispanstream stream(file.bytes());
     return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
-std::string joinLines(std::span<const std::string> lines)
+std::string joinLines(const aoc::Grid<char>& grid)
 {
     std::string result;
-    for (const std::string& line : lines)
-        result += line, result += '\n';
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        const auto row = grid.rowCells(i);
+        result.append(row.begin(), row.end()), result += '\n';
+    }
     return result;
 }
 
-std::pair<std::string, std::int64_t> solve(std::span<const std::string> grid)
+std::pair<std::string, std::int64_t> solve(const aoc::Grid<char>& grid)
 {
-    const std::int64_t m = grid.size(), n = grid.empty() ? 0 : grid[0].size();
-    std::vector<std::string> marked(grid.begin(), grid.end()),
-                             counts(m, std::string(n, '\0'));
-    std::queue<std::array<std::int64_t, 2>> frontier;
-    for (std::int64_t ii = 0; ii < m; ++ii) {
-        for (std::int64_t jj = 0; jj < n; ++jj) {
-            if (grid[ii][jj] == '@') {
+    aoc::Grid<char> marked(grid), counts(grid, '\0', '\0');
+    std::queue<Index> frontier;
+    for (Index i = 0; i < grid.numRows(); ++i) {
+        for (Index j = 0; j < grid.numCols(); ++j) {
+            if (const Index index = grid.index(i, j); grid[index] == '@') {
                 std::int64_t cnt = 0;
-                for (std::int64_t
-                     iMin = std::max(0L, ii-1), iMax = std::min(n-1, ii+1),
-                     jMin = std::max(0L, jj-1), jMax = std::min(n-1, jj+1),
-                     i = iMin; i <= iMax; ++i)
-                    for (std::int64_t j = jMin; j <= jMax; ++j)
-                        if (((i != ii) || (j != jj)) && (grid[i][j] == '@'))
-                            ++cnt;
-                counts[ii][jj] = cnt;
+                for (const Index offset : grid.neighbors8())
+                    cnt += (grid[index + offset] == '@');
+                counts[index] = cnt;
                 if (cnt < 4)
-                    frontier.push({ii, jj});
+                    frontier.push(index);
             }
         }
     }
     std::int64_t numRolls = 0;
     while (!frontier.empty()) {
-        const auto [ii, jj] = frontier.front();
+        const Index index = frontier.front();
         frontier.pop();
-        marked[ii][jj] = '.';
-        --counts[ii][jj];
+        marked[index] = '.';
+        --counts[index];
         ++numRolls;
-        for (std::int64_t
-             iMin = std::max(0L, ii-1), iMax = std::min(n-1, ii+1),
-             jMin = std::max(0L, jj-1), jMax = std::min(n-1, jj+1),
-             i = iMin; i <= iMax; ++i)
-            for (std::int64_t j = jMin; j <= jMax; ++j)
-                if (((i != ii) || (j != jj)) && (grid[i][j] == '@') &&
-                    (counts[i][j]-- == 4))
-                    frontier.push({i, j});
+        for (const Index offset : grid.neighbors8())
+            if (const Index next = index + offset;
+                (grid[next] == '@') && (counts[next]-- == 4))
+                frontier.push(next);
     }
     return { joinLines(marked), numRolls };
 }
@@ -90,17 +87,19 @@ void check(int              lineNumber,
            std::int64_t     expectedRolls,
            std::string_view source)
 {
-    const auto [marks, numRolls] = solve(getInput(source));
-    if (marks != expectedMarks)
-        std::cerr
-            << std::format("failure({}):\n> expected:\n{}\n> actual:\n{}\n",
-                           lineNumber, expectedMarks, marks)
-            << std::endl;
-    if (numRolls != expectedRolls)
-        std::cerr
-            << std::format("failure({}):\n> expected: {}, \n> actual:   {}\n",
-                           lineNumber, expectedRolls, numRolls)
-            << std::endl;
+    aoc::addCheck(lineNumber, [=] {
+        const auto [marks, numRolls] = solve(getInput(source));
+        if (marks != expectedMarks)
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected:\n{}\n> actual:\n{}\n",
+                               lineNumber, expectedMarks, marks)
+                << std::endl;
+        if (numRolls != expectedRolls)
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}, \n> actual:   {}\n",
+                               lineNumber, expectedRolls, numRolls)
+                << std::endl;
+    });
 }
 
 void runTests()
@@ -131,11 +130,11 @@ void runTests()
     );
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto [_marks, numRolls] = solve(getInput());
-    std::cout << numRolls << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& grid) { return solve(grid).second; });
 }
@@ -4,19 +4,21 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <map>
 #include <numeric>
 #include <ranges>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Input {
     std::vector<std::array<std::int64_t, 2>> d_ranges;
     std::vector<std::int64_t>                d_ids;
@@ -45,21 +47,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -94,13 +89,15 @@ void check(int              lineNumber,
            std::string_view source)
 
 {
-    if (const auto numFresh = solve(getInput(source));
-        numFresh != expectedNumFresh) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectedNumFresh, numFresh)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto numFresh = solve(getInput(source));
+            numFresh != expectedNumFresh) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectedNumFresh, numFresh)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -121,11 +118,11 @@ R"(3-5
     check(__LINE__, 14, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto numFresh = solve(getInput());
-    std::cout << numFresh << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
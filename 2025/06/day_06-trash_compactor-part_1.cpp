@@ -4,19 +4,23 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <map>
 #include <numeric>
 #include <ranges>
 #include <span>
+#include <spanstream>
 #include <sstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Expression {
     std::vector<std::int64_t> d_operands;
     char                      d_operator = 'X';
@@ -52,21 +56,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -90,27 +87,81 @@ std::int64_t solve(std::span<const Expression> input)
                                  std::plus{}, &eval);
 }
 
+// Return the grand total of the worksheet whose rows are 'lines', folding
+// each row of numbers into a running sum and product per problem as it is
+// read, and choosing between them on the row of operators.  As the rows are
+// very long, the memory used still grows with the width of the worksheet:
+// 'LineReader' holds a whole row, and there are 16 bytes per problem.
+template <class LINES>
+std::int64_t solveStreaming(LINES&& lines)
+{
+    std::vector<std::int64_t> sums, products;
+    for (const std::string_view line : lines) {
+        if (line.find_first_of("+*") != std::string_view::npos) {
+            std::int64_t total = 0;
+            for (std::size_t i = 0, j = 0; i < sums.size(); ++i, ++j) {
+                j = line.find_first_of("+*", j);
+                assert(j != std::string_view::npos);
+                total += line[j] == '+' ? sums[i] : products[i];
+            }
+            return total;
+        }
+
+        const char *cursor = line.data(), *const end = cursor + line.size();
+        for (std::size_t i = 0; ; ++i) {
+            cursor = std::find_if(cursor, end, [](char c) { return c != ' '; });
+            if (cursor == end)
+                break;
+            std::int64_t operand = 0;
+            const auto [ptr, errc] = std::from_chars(cursor, end, operand);
+            assert(errc == std::errc());
+            cursor = ptr;
+            if (i == sums.size()) {
+                sums.push_back(0);
+                products.push_back(1);
+            }
+            sums[i]     += operand;
+            products[i] *= operand;
+        }
+    }
+    assert(!"missing operator row");
+    return 0;
+}
+
 void check(int               lineNumber,
            std::int64_t      expectedValue,
            const Expression& expression)
 {
-    if (const auto value = eval(expression); value != expectedValue) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectedValue, value)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto value = eval(expression); value != expectedValue) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectedValue, value)
+                << std::endl;
+        }
+    });
 }
 
 void check(int lineNumber, std::int64_t expectedTotal, std::string_view source)
 
 {
-    if (const auto total = solve(getInput(source)); total != expectedTotal) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectedTotal, total)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto total = solve(getInput(source));
+            total != expectedTotal) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectedTotal, total)
+                << std::endl;
+        }
+        if (const auto total = solveStreaming(aoc::lines(source));
+            total != expectedTotal) {
+            *aoc::failureStream()
+                << std::format("failure({}, streaming):\n> expected: {}\n"
+                               "> actual:   {}\n",
+                               lineNumber, expectedTotal, total)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -128,11 +179,13 @@ R"(123 328  51 64
     check(__LINE__, 4277556, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto total = solve(getInput());
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& input) { return solve(input); },
+        [] { return solveStreaming(aoc::LineReader(aoc::findInputFile())); });
 }
@@ -4,19 +4,22 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <map>
 #include <numeric>
 #include <ranges>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Expression {
     std::vector<std::int64_t> d_operands;
     char                      d_operator = 'X';
@@ -69,21 +72,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -121,15 +117,77 @@ std::int64_t solve(std::span<const Expression> input)
                                  std::plus{}, &eval);
 }
 
+// Return the grand total of the worksheet whose rows are 'lines', building
+// the number in each character column digit by digit as the rows are read;
+// columns without digits separate the problems, whose operators are on the
+// last row.  Note that, unlike the other streaming solutions, this one does
+// not run in constant memory: the input is a handful of very long lines, and
+// both the line buffer and 'columns' (8 bytes per character column) grow with
+// the width of the worksheet, i.e. to a few times the size of the input.
+template <class LINES>
+std::int64_t solveStreaming(LINES&& lines)
+{
+    std::vector<std::int64_t> columns;
+    std::vector<bool>         hasDigits;
+    for (const std::string_view line : lines) {
+        if (line.find_first_of("+*") == std::string_view::npos) {
+            if (line.size() > columns.size()) {
+                columns.resize(line.size());
+                hasDigits.resize(line.size());
+            }
+            for (std::size_t j = 0; j < line.size(); ++j) {
+                if (line[j] != ' ') {
+                    columns[j]   = 10 * columns[j] + (line[j] - '0');
+                    hasDigits[j] = true;
+                }
+            }
+            continue;
+        }
+
+        std::int64_t total = 0;
+        for (std::size_t begin = 0; begin < columns.size(); ) {
+            if (!hasDigits[begin]) {
+                ++begin;
+                continue;
+            }
+            std::size_t end = begin;
+            while (end < columns.size() && hasDigits[end])
+                ++end;
+            const std::size_t opIndex =
+                                   line.substr(0, end).find_first_of("+*", begin);
+            assert(opIndex != std::string_view::npos);
+            Expression expression{{}, line[opIndex]};
+            expression.d_operands.assign(columns.begin() + begin,
+                                         columns.begin() + end);
+            total += eval(expression);
+            begin = end;
+        }
+        return total;
+    }
+    assert(!"missing operator row");
+    return 0;
+}
+
 void check(int lineNumber, std::int64_t expectedTotal, std::string_view source)
 
 {
-    if (const auto total = solve(getInput(source)); total != expectedTotal) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectedTotal, total)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto total = solve(getInput(source));
+            total != expectedTotal) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectedTotal, total)
+                << std::endl;
+        }
+        if (const auto total = solveStreaming(aoc::lines(source));
+            total != expectedTotal) {
+            *aoc::failureStream()
+                << std::format("failure({}, streaming):\n> expected: {}\n"
+                               "> actual:   {}\n",
+                               lineNumber, expectedTotal, total)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -143,11 +201,13 @@ R"(123 328  51 64
     check(__LINE__, 3263827, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto total = solve(getInput());
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::runStreamable(
+        argc, argv, "1",
+        [] { return getInput(); },
+        [](const auto& input) { return solve(input); },
+        [] { return solveStreaming(aoc::LineReader(aoc::findInputFile())); });
 }
@@ -4,18 +4,20 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <numeric>
 #include <ranges>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 auto getInput(std::istream& stream)
 {
     std::vector<std::string> input;
@@ -26,21 +28,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -73,12 +68,15 @@ std::int64_t solve(std::span<const std::string> input)
 void check(int lineNumber, std::int64_t expectedTotal, std::string_view source)
 
 {
-    if (const auto total = solve(getInput(source)); total != expectedTotal) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectedTotal, total)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto total = solve(getInput(source));
+            total != expectedTotal) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectedTotal, total)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -104,11 +102,11 @@ R"(.......S.......
     check(__LINE__, 21, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto total = solve(getInput());
-    std::cout << total << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
@@ -3,17 +3,19 @@
 #include <charconv>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Point {
     std::int64_t d_x, d_y, d_z;
 };
@@ -49,21 +51,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -102,13 +97,15 @@ std::int64_t solve(std::span<const Point> input)
 
 void check(int lineNumber, std::int64_t expectProduct, std::string_view source)
 {
-    if (const auto product = solve(getInput(source));
-        product != expectProduct) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectProduct, product)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto product = solve(getInput(source));
+            product != expectProduct) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectProduct, product)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -138,11 +135,11 @@ R"(162,817,812
     check(__LINE__, 25272, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto product = solve(getInput());
-    std::cout << product << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
@@ -4,16 +4,18 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 struct Point {
     std::int64_t d_x, d_y;
     auto operator<=>(const Point&) const = default;
@@ -38,21 +40,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -77,13 +72,15 @@ std::int64_t solve(std::span<const Point> input)
 
 void check(int lineNumber, std::int64_t expectMaxArea, std::string_view source)
 {
-    if (const auto maxArea = solve(getInput(source));
-        maxArea != expectMaxArea) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectMaxArea, maxArea)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto maxArea = solve(getInput(source));
+            maxArea != expectMaxArea) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectMaxArea, maxArea)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -101,11 +98,11 @@ R"(7,1
     check(__LINE__, 50, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto maxArea = solve(getInput());
-    std::cout << maxArea << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
@@ -3,17 +3,20 @@
 #include <charconv>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
+#include <spanstream>
 #include <unordered_set>
 #include <span>
-#include <sstream>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/grid.h>
+#include <aoc/mapped_file.h>
+#include <aoc/run.h>
+
 using namespace std::chrono_literals;
 
 struct Point {
@@ -40,21 +43,14 @@ auto getInput(std::istream& stream)
 
 auto getInput()
 {
-    for (const auto& entry : std::filesystem::directory_iterator(".")) {
-        if (std::filesystem::is_regular_file(entry.path()) &&
-            entry.path().string().ends_with("-input.txt")) {
-            std::ifstream stream(entry.path().string());
-            return getInput(stream);
-        }
-    }
-    std::cerr << "Failed to find input file in the current directory"
-              << std::endl;
-    std::abort();
+    const aoc::MappedFile file(aoc::findInputFile());
+    std::ispanstream stream(file.bytes());
+    return getInput(stream);
 }
 
 auto getInput(std::string_view input)
 {
-    std::istringstream stream{std::string(input)};
+    std::ispanstream stream(input);
     return getInput(stream);
 }
 
@@ -85,37 +81,35 @@ std::int64_t solve(std::span<const Point> input)
     const auto iForX = [&](std::int64_t x) { return indexFor(xSorted, x); };
     const auto jForY = [&](std::int64_t y) { return indexFor(ySorted, y); };
     const std::int64_t N = input.size(), m = xSorted.size(), n = ySorted.size();
-    std::vector<std::vector<bool>> grid(m, std::vector<bool>(n));
+    // The border is marked so that the flood fill stops at it.
+    aoc::BitGrid grid(m, n, true);
     for (std::int64_t i = 0; i < N; ++i) {
         const auto p1 = input[i], p2 = input[(i+1)%N];
         if (p1.d_x == p2.d_x) {
             const auto [y1, y2] = std::minmax(p1.d_y, p2.d_y);
             const auto i = iForX(p1.d_x), j1 = jForY(y1), j2 = jForY(y2);
             for (auto j = j1; j <= j2; ++j)
-                grid[i][j] = true;
+                grid.set(grid.index(i, j));
         }
         else if (p1.d_y == p2.d_y) {
             const auto [x1, x2] = std::minmax(p1.d_x, p2.d_x);
             const auto i1 = iForX(x1), i2 = iForX(x2), j = jForY(p1.d_y);
             for (auto i = i1; i <= i2; ++i)
-                grid[i][j] = true;
+                grid.set(grid.index(i, j));
         }
         else {
             assert(!"bad input");
             std::abort();
         }
     }
-    const auto floodFill = [&](this auto&& floodFill, std::int64_t i, std::int64_t j) -> void {
-        grid[i][j] = true;
-        constexpr std::int64_t k_Dir[] = { 1, 0, -1, 0, 1 };
-        for (std::int64_t d = 0; d < 4; ++d)
-            if (const auto nI = i + k_Dir[d], nJ = j + k_Dir[d+1];
-                (nI >= 0) && (nI < m) &&
-                (nJ >= 0) && (nJ < n) &&
-                !grid[nI][nJ])
-                floodFill(nI, nJ);
+    const auto floodFill = [&](this auto&&        floodFill,
+                               aoc::BitGrid::Index index) -> void {
+        grid.set(index);
+        for (const auto offset : grid.neighbors())
+            if (!grid.test(index + offset))
+                floodFill(index + offset);
     };
-    floodFill(m/2, n/2);
+    floodFill(grid.index(m/2, n/2));
     std::int64_t maxArea = 0;
     for (std::int64_t I = 0; I < N; ++I) {
         for (std::int64_t J = I+1; J < N; ++J) {
@@ -127,7 +121,7 @@ std::int64_t solve(std::span<const Point> input)
             const std::int64_t j1 = jForY(yMin), j2 = jForY(yMax);
             for (std::int64_t i = i1; i <= i2; ++i) {
                 for (std::int64_t j = j1; j <= j2; ++j) {
-                    if (!grid[i][j]) {
+                    if (!grid.test(grid.index(i, j))) {
                         goto nextPair;
                     }
                 }
@@ -141,13 +135,15 @@ std::int64_t solve(std::span<const Point> input)
 
 void check(int lineNumber, std::int64_t expectMaxArea, std::string_view source)
 {
-    if (const auto maxArea = solve(getInput(source));
-        maxArea != expectMaxArea) {
-        std::cerr
-            << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                           lineNumber, expectMaxArea, maxArea)
-            << std::endl;
-    }
+    aoc::addCheck(lineNumber, [=] {
+        if (const auto maxArea = solve(getInput(source));
+            maxArea != expectMaxArea) {
+            *aoc::failureStream()
+                << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                               lineNumber, expectMaxArea, maxArea)
+                << std::endl;
+        }
+    });
 }
 
 void runTests()
@@ -174,11 +170,11 @@ R"(7,1
     check(__LINE__, 24, example);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     runTests();
 
-    const auto maxArea = solve(getInput());
-    std::cout << maxArea << std::endl;
-    return 0;
+    return aoc::run(argc, argv, "1",
+                    [] { return getInput(); },
+                    [](const auto& input) { return solve(input); });
 }
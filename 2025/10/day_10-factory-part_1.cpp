@@ -4,24 +4,39 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
 #include <queue>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <aoc/checks.h>
+#include <aoc/digest.h>
+#include <aoc/mapped_file.h>
+#include <aoc/result_cache.h>
+#include <aoc/run.h>
+
 struct Machine {
   std::string d_indicators;
   std::vector<std::vector<std::int64_t>> d_buttons;
   std::vector<std::int64_t> d_joltages;
 };
 
+// Digest of everything that 'configure' reads from 'm', keying its result in
+// the cache.
+aoc::Digest digestMachine(const Machine &m) {
+  aoc::Hasher hasher;
+  hasher.add(m.d_indicators).add(m.d_buttons.size());
+  for (const auto &buttons : m.d_buttons)
+    hasher.add(std::span<const std::int64_t>(buttons));
+  hasher.add(std::span<const std::int64_t>(m.d_joltages));
+  return hasher.digest();
+}
+
 void getMachine(Machine &m, std::string_view line) {
   const auto iOpen = line.find('[', 0);
   assert(iOpen != std::string::npos);
@@ -66,20 +81,13 @@ auto getInput(std::istream &stream) {
 }
 
 auto getInput() {
-  for (const auto &entry : std::filesystem::directory_iterator(".")) {
-    if (std::filesystem::is_regular_file(entry.path()) &&
-        entry.path().string().ends_with("-input.txt")) {
-      std::ifstream stream(entry.path().string());
-      return getInput(stream);
-    }
-  }
-  std::cerr << "Failed to find input file in the current directory"
-            << std::endl;
-  std::abort();
+  const aoc::MappedFile file(aoc::findInputFile());
+  std::ispanstream stream(file.bytes());
+  return getInput(stream);
 }
 
 auto getInput(std::string_view input) {
-  std::istringstream stream{std::string(input)};
+  std::ispanstream stream(input);
   return getInput(stream);
 }
 
@@ -107,26 +115,35 @@ std::int64_t configure(const Machine& m) {
 }
 
 std::int64_t solve(std::span<const Machine> input) {
+    // Per machine, as every search is independent.
+    static aoc::ResultCache s_cache("2025/10-part_1", "1");
     std::int64_t sum = 0;
     for (const auto& m : input)
-        sum += configure(m);
+        sum += s_cache.findOrCompute(digestMachine(m),
+                                     [&] { return configure(m); });
     return sum;
 }
 
 void check(int lineNumber, std::int64_t expectedPresses, const Machine &m) {
-  if (const auto numPresses = configure(m); numPresses != expectedPresses) {
-    std::cerr << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                             lineNumber, expectedPresses, numPresses)
-              << std::endl;
-  }
+  aoc::addCheck(lineNumber, [=] {
+    if (const auto numPresses = configure(m); numPresses != expectedPresses) {
+      *aoc::failureStream()
+          << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                         lineNumber, expectedPresses, numPresses)
+          << std::endl;
+    }
+  });
 }
 
 void check(int lineNumber, std::int64_t expectedSum, std::string_view source) {
-  if (const auto sum = solve(getInput(source)); sum != expectedSum) {
-    std::cerr << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                             lineNumber, expectedSum, sum)
-              << std::endl;
-  }
+  aoc::addCheck(lineNumber, [=] {
+    if (const auto sum = solve(getInput(source)); sum != expectedSum) {
+      *aoc::failureStream()
+          << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                         lineNumber, expectedSum, sum)
+          << std::endl;
+    }
+  });
 }
 
 void runTests() {
@@ -141,10 +158,10 @@ R"([.##.] (3) (1,3) (2) (2,3) (0,2) (0,1) {3,5,4,7}
   check(__LINE__, 7, example);
 }
 
-int main() {
+int main(int argc, char *argv[]) {
   runTests();
 
-  const auto sum = solve(getInput());
-  std::cout << sum << std::endl;
-  return 0;
+  return aoc::run(argc, argv, "1",
+                  [] { return getInput(); },
+                  [](const auto &input) { return solve(input); });
 }
@@ -6,14 +6,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <queue>
 #include <span>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
@@ -23,6 +21,12 @@
 #include <CoinModel.hpp>
 #include <OsiClpSolverInterface.hpp>
 
+#include <aoc/checks.h>
+#include <aoc/digest.h>
+#include <aoc/mapped_file.h>
+#include <aoc/result_cache.h>
+#include <aoc/run.h>
+
 void apply(std::span<std::int64_t>       joltages,
            std::span<const std::int64_t> buttons,
            std::int64_t                  delta)
@@ -50,24 +54,23 @@ std::ostream &operator<<(std::ostream &stream,
   return stream;
 }
 
-namespace std {
-  template<>
-  struct hash<std::vector<std::int64_t>> {
-    std::size_t operator()(const std::vector<std::int64_t>& joltages) const {
-      const char *const j = reinterpret_cast<const char *>(joltages.data()),
-                        *const jEnd = j + joltages.size();
-      const std::string_view str(j, jEnd);
-      return hash<std::string_view>{}(str);
-    }
-  };
-};
-
 struct Machine {
   std::string                            d_indicators;
   std::vector<std::vector<std::int64_t>> d_buttons;
   std::vector<std::int64_t>              d_joltages;
 };
 
+// Digest of everything that 'configure' reads from 'm', keying its result in
+// the cache.
+aoc::Digest digestMachine(const Machine &m) {
+  aoc::Hasher hasher;
+  hasher.add(m.d_indicators).add(m.d_buttons.size());
+  for (const auto &buttons : m.d_buttons)
+    hasher.add(std::span<const std::int64_t>(buttons));
+  hasher.add(std::span<const std::int64_t>(m.d_joltages));
+  return hasher.digest();
+}
+
 void getMachine(Machine &m, std::string_view line) {
   const auto iOpen = line.find('[', 0);
   assert(iOpen != std::string::npos);
@@ -113,20 +116,13 @@ auto getInput(std::istream &stream) {
 }
 
 auto getInput() {
-  for (const auto &entry : std::filesystem::directory_iterator(".")) {
-    if (std::filesystem::is_regular_file(entry.path()) &&
-        entry.path().string().ends_with("-input.txt")) {
-      std::ifstream stream(entry.path().string());
-      return getInput(stream);
-    }
-  }
-  std::cerr << "Failed to find input file in the current directory"
-            << std::endl;
-  std::abort();
+  const aoc::MappedFile file(aoc::findInputFile());
+  std::ispanstream stream(file.bytes());
+  return getInput(stream);
 }
 
 auto getInput(std::string_view input) {
-  std::istringstream stream{std::string(input)};
+  std::ispanstream stream(input);
   return getInput(stream);
 }
 
@@ -168,7 +164,6 @@ std::int64_t configure(const Machine &m) {
 
     const double* sol = model.bestSolution();
     std::int64_t sum = 0;
-    std::cout << "    ";
     for (int j = 0; j < numCols; ++j) {
       sum += std::round(sol[j]);
     }
@@ -176,27 +171,36 @@ std::int64_t configure(const Machine &m) {
 }
 
 std::int64_t solve(std::span<const Machine> input) {
+  // Per machine, as every branch-and-bound run is independent.
+  static aoc::ResultCache s_cache("2025/10-part_2", "1");
   std::int64_t sum = 0;
   for (const auto &m : input) {
-    sum += configure(m);
+    sum += s_cache.findOrCompute(digestMachine(m),
+                                 [&] { return configure(m); });
   }
   return sum;
 }
 
 void check(int lineNumber, std::int64_t expectedPresses, const Machine &m) {
-  if (const auto numPresses = configure(m); numPresses != expectedPresses) {
-    std::cerr << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                             lineNumber, expectedPresses, numPresses)
-              << std::endl;
-  }
+  aoc::addCheck(lineNumber, [=] {
+    if (const auto numPresses = configure(m); numPresses != expectedPresses) {
+      *aoc::failureStream()
+          << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                         lineNumber, expectedPresses, numPresses)
+          << std::endl;
+    }
+  });
 }
 
 void check(int lineNumber, std::int64_t expectedSum, std::string_view source) {
-  if (const auto sum = solve(getInput(source)); sum != expectedSum) {
-    std::cerr << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                             lineNumber, expectedSum, sum)
-              << std::endl;
-  }
+  aoc::addCheck(lineNumber, [=] {
+    if (const auto sum = solve(getInput(source)); sum != expectedSum) {
+      *aoc::failureStream()
+          << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                         lineNumber, expectedSum, sum)
+          << std::endl;
+    }
+  });
 }
 
 void runTests() {
@@ -211,10 +215,10 @@ R"([.##.] (3) (1,3) (2) (2,3) (0,2) (0,1) {3,5,4,7}
   check(__LINE__, 33, example);
 }
 
-int main() {
+int main(int argc, char *argv[]) {
   runTests();
 
-  const auto sum = solve(getInput());
-  std::cout << "sum: " << sum << std::endl;
-  return 0;
+  return aoc::run(argc, argv, "1",
+                  [] { return getInput(); },
+                  [](const auto &input) { return solve(input); });
 }
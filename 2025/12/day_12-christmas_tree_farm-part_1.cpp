@@ -7,13 +7,23 @@
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <functional>
 #include <iostream>
-#include <sstream>
+#include <span>
+#include <spanstream>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include <unistd.h>
+
+#include <aoc/checks.h>
+#include <aoc/digest.h>
+#include <aoc/mapped_file.h>
+#include <aoc/result_cache.h>
+#include <aoc/run.h>
+
 // 0+0
 // AAA.
 // ABAB
@@ -33,18 +43,15 @@ struct Requirement {
 
 using Orientation = std::array<std::array<char, 3>, 3>;
 
-namespace std {
-  template<>
-  struct hash<Orientation> {
-    std::size_t operator()(const Orientation& o) const {
-      const char buffer[] = { o[0][0], o[0][1], o[0][2],
-                              o[1][0], o[1][1], o[1][2],
-                              o[2][0], o[2][1], o[2][2] };
-      return hash<string_view>{}(
-          std::string_view(buffer, buffer + sizeof(buffer)));
-    }
-  };
-}
+struct OrientationHash {
+  std::size_t operator()(const Orientation& o) const {
+    const char buffer[] = { o[0][0], o[0][1], o[0][2],
+                            o[1][0], o[1][1], o[1][2],
+                            o[2][0], o[2][1], o[2][2] };
+    return std::hash<std::string_view>{}(
+        std::string_view(buffer, buffer + sizeof(buffer)));
+  }
+};
 
 struct Present {
   std::vector<Orientation> d_orientations;
@@ -84,7 +91,7 @@ Present makePresent(std::string_view r1,
     r1.copy(o[0].data(), 3);
     r2.copy(o[1].data(), 3);
     r3.copy(o[2].data(), 3);
-    std::unordered_set<Orientation> uniques;
+    std::unordered_set<Orientation, OrientationHash> uniques;
     uniques.insert(o); rotate(o);
     uniques.insert(o); rotate(o);
     uniques.insert(o); rotate(o);
@@ -149,20 +156,13 @@ auto getInput(std::istream &stream) {
 }
 
 auto getInput() {
-  for (const auto &entry : std::filesystem::directory_iterator(".")) {
-    if (std::filesystem::is_regular_file(entry.path()) &&
-        entry.path().string().ends_with("-input.txt")) {
-      std::ifstream stream(entry.path().string());
-      return getInput(stream);
-    }
-  }
-  std::cerr << "Failed to find input file in the current directory"
-            << std::endl;
-  std::abort();
+  const aoc::MappedFile file(aoc::findInputFile());
+  std::ispanstream stream(file.bytes());
+  return getInput(stream);
 }
 
 auto getInput(std::string_view input) {
-  std::istringstream stream{std::string(input)};
+  std::ispanstream stream(input);
   return getInput(stream);
 }
 
@@ -326,9 +326,18 @@ bool canFit(std::span<const Present> presents, const Requirement &r) {
   assert(m >= 3);
   assert(n >= 3);
   assert(presents.size() == numPresents.size());
-  const std::string cnfFile("day_12.cnf");
+  // 'mkstemps' creates a fresh file, so that concurrent threads and
+  // processes never share one.  The solver's verdict is in its exit code,
+  // and its stdout must not mix with ours.
+  std::string cnfFile =
+      (std::filesystem::temp_directory_path() / "day_12-XXXXXX.cnf").string();
+  const int fd = ::mkstemps(cnfFile.data(), 4);
+  assert(fd >= 0);
+  ::close(fd);
   writeCnf(cnfFile, presents, r);
-  const int status = std::system(("cryptominisat " + cnfFile).c_str());
+  const int status = std::system(
+      std::format("cryptominisat '{}' > /dev/null", cnfFile).c_str());
+  std::filesystem::remove(cnfFile);
   assert(WIFEXITED(status));
   const int exitCode = WEXITSTATUS(status);
   assert((exitCode == 10) || (exitCode == 20));
@@ -336,21 +345,34 @@ bool canFit(std::span<const Present> presents, const Requirement &r) {
 }
 
 std::int64_t solve(const Input& input) {
-  std::int64_t total = 0, i = 0;
+  // Per requirement, under the digest of the presents as well, as every
+  // solver run is independent.
+  static aoc::ResultCache s_cache("2025/12-part_1", "1");
+  aoc::Hasher presentsHasher;
+  for (const auto& present : input.d_presents)
+    presentsHasher.add(std::span<const Orientation>(present.d_orientations));
+
+  std::int64_t total = 0;
   for (const auto& r : input.d_requirements) {
-    std::cout << ++i << std::endl;
-    total += canFit(input.d_presents, r);
+    aoc::Hasher key(presentsHasher);
+    key.add(r.d_m).add(r.d_n).add(std::span<const std::int64_t>(r.d_numPresents));
+    total += s_cache.findOrCompute(
+        key.digest(), [&] { return canFit(input.d_presents, r); });
   }
   return total;
 }
 
 void check(int lineNumber, std::int64_t expectMaxArea,
            std::string_view source) {
-  if (const auto maxArea = solve(getInput(source)); maxArea != expectMaxArea) {
-    std::cerr << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
-                             lineNumber, expectMaxArea, maxArea)
-              << std::endl;
-  }
+  aoc::addCheck(lineNumber, [=] {
+    if (const auto maxArea = solve(getInput(source));
+        maxArea != expectMaxArea) {
+      *aoc::failureStream()
+          << std::format("failure({}):\n> expected: {}\n> actual:   {}\n",
+                         lineNumber, expectMaxArea, maxArea)
+          << std::endl;
+    }
+  });
 }
 
 void runTests() {
@@ -392,10 +414,10 @@ void runTests() {
   check(__LINE__, 2, example);
 }
 
-int main() {
+int main(int argc, char *argv[]) {
   // runTests();
 
-  const auto result = solve(getInput());
-  std::cout << result << std::endl;
-  return 0;
+  return aoc::run(argc, argv, "1",
+                  [] { return getInput(); },
+                  [](const auto &input) { return solve(input); });
 }
@@ -0,0 +1,137 @@
+#ifndef INCLUDED_AOC_AHO_CORASICK
+#define INCLUDED_AOC_AHO_CORASICK
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace aoc {
+
+// Aho-Corasick automaton over a fixed dictionary of words: fed one character
+// at a time with 'next', it is in a state whose 'matches' are the indices of
+// every word that ends at that character, so a text is searched for all of
+// the words in one pass, however many there are.  The transitions are a
+// complete table over the characters that occur in the words (every other
+// character leads back to the start), so each step is a single lookup.
+class AhoCorasick {
+  public:
+    using State = std::uint32_t;
+
+    explicit AhoCorasick(std::span<const std::string_view> words)
+    {
+        // Number the characters of the words from 1; 0 is every other one.
+        for (const std::string_view word : words) {
+            assert(!word.empty());
+            for (const char c : word)
+                if (!d_classes[static_cast<unsigned char>(c)])
+                    d_classes[static_cast<unsigned char>(c)] = d_numClasses++;
+            d_wordLengths.push_back(word.size());
+        }
+
+        // Build the trie, with 0 standing for "no edge" as no edge leads to
+        // the root.
+        std::vector<std::vector<std::uint32_t>> ownWords(1);
+        d_next.assign(d_numClasses, 0);
+        for (std::size_t w = 0; w < words.size(); ++w) {
+            State state = 0;
+            for (const char c : words[w]) {
+                State& child = d_next[state * d_numClasses + classOf(c)];
+                if (!child) {
+                    child = ownWords.size();
+                    ownWords.emplace_back();
+                    d_next.resize(d_next.size() + d_numClasses, 0);
+                }
+                state = d_next[state * d_numClasses + classOf(c)];
+            }
+            ownWords[state].push_back(w);
+        }
+
+        // Complete the transitions breadth first, so that every missing edge
+        // of a state is its failure state's edge, and gather each state's
+        // matches: its own words, then those of its failure state.
+        const std::size_t  numStates = ownWords.size();
+        std::vector<State> failure(numStates, 0);
+        std::deque<State>  queue;
+        d_matchOffsets.assign(numStates + 1, 0);
+        std::vector<std::vector<std::uint32_t>> matches(numStates);
+        matches[0] = ownWords[0];
+        for (std::size_t c = 0; c < d_numClasses; ++c)
+            if (const State child = d_next[c])
+                queue.push_back(child);
+        while (!queue.empty()) {
+            const State state = queue.front();
+            queue.pop_front();
+            matches[state] = ownWords[state];
+            matches[state].insert(matches[state].end(),
+                                  matches[failure[state]].begin(),
+                                  matches[failure[state]].end());
+            for (std::size_t c = 0; c < d_numClasses; ++c) {
+                State&      edge     = d_next[state * d_numClasses + c];
+                const State fallback =
+                                   d_next[failure[state] * d_numClasses + c];
+                if (edge) {
+                    failure[edge] = fallback;
+                    queue.push_back(edge);
+                }
+                else {
+                    edge = fallback;
+                }
+            }
+        }
+        for (std::size_t s = 0; s < numStates; ++s) {
+            d_matchOffsets[s + 1] = d_matchOffsets[s] + matches[s].size();
+            d_matchWords.insert(d_matchWords.end(),
+                                matches[s].begin(), matches[s].end());
+        }
+    }
+
+    static constexpr State start()
+    {
+        return 0;
+    }
+
+    State next(State state, char c) const
+    {
+        return d_next[state * d_numClasses + classOf(c)];
+    }
+
+    // Indices of the words that end where 'state' was reached.
+    std::span<const std::uint32_t> matches(State state) const
+    {
+        const std::uint32_t begin = d_matchOffsets[state],
+                            end   = d_matchOffsets[state + 1];
+        return std::span(d_matchWords).subspan(begin, end - begin);
+    }
+
+    std::size_t numWords() const
+    {
+        return d_wordLengths.size();
+    }
+
+    std::size_t wordLength(std::size_t word) const
+    {
+        return d_wordLengths[word];
+    }
+
+  private:
+    std::size_t classOf(char c) const
+    {
+        return d_classes[static_cast<unsigned char>(c)];
+    }
+
+    std::array<std::uint16_t, 256> d_classes{};
+    std::size_t                    d_numClasses = 1;
+    std::vector<State>             d_next;          // by state, then class
+    std::vector<std::uint32_t>     d_matchOffsets;  // by state
+    std::vector<std::uint32_t>     d_matchWords;
+    std::vector<std::size_t>       d_wordLengths;
+};
+
+} // close namespace aoc
+
+#endif
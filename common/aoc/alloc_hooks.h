@@ -0,0 +1,163 @@
+#ifndef INCLUDED_AOC_ALLOC_HOOKS
+#define INCLUDED_AOC_ALLOC_HOOKS
+
+// Replacement global 'operator new' and 'operator delete' (every standard
+// form) that forward to 'malloc' and 'free' and keep 'aoc::allocCounters()'
+// up to date.  These are definitions, not declarations: include this header
+// in exactly one translation unit of a program.  <aoc/phase.h> does so when
+// 'AOC_ALLOC_STATS' is defined, which 'make release ALLOC_STATS=1' arranges;
+// the multi-day runner, made of many such units, must not define it.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include <malloc.h>
+
+#include <aoc/alloc_stats.h>
+
+namespace aoc {
+namespace allocHooks {
+
+inline void *allocate(std::size_t size, std::size_t alignment) noexcept
+{
+    if (size == 0)
+        size = 1;
+
+    void *const ptr = alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__
+                    ? std::malloc(size)
+                    : std::aligned_alloc(
+                          alignment, (size + alignment - 1) & ~(alignment - 1));
+    if (ptr)
+        allocCounters().recordAlloc(::malloc_usable_size(ptr));
+    return ptr;
+}
+
+inline void *allocateOrThrow(std::size_t size, std::size_t alignment)
+{
+    void *const ptr = allocate(size, alignment);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+inline void deallocate(void *ptr) noexcept
+{
+    if (ptr) {
+        allocCounters().recordFree(::malloc_usable_size(ptr));
+        std::free(ptr);
+    }
+}
+
+} // close namespace allocHooks
+} // close namespace aoc
+
+void *operator new(std::size_t size)
+{
+    return aoc::allocHooks::allocateOrThrow(size, 0);
+}
+
+void *operator new[](std::size_t size)
+{
+    return aoc::allocHooks::allocateOrThrow(size, 0);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return aoc::allocHooks::allocateOrThrow(size, std::size_t(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return aoc::allocHooks::allocateOrThrow(size, std::size_t(alignment));
+}
+
+void *operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return aoc::allocHooks::allocate(size, 0);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return aoc::allocHooks::allocate(size, 0);
+}
+
+void *operator new(std::size_t             size,
+                   std::align_val_t        alignment,
+                   const std::nothrow_t&) noexcept
+{
+    return aoc::allocHooks::allocate(size, std::size_t(alignment));
+}
+
+void *operator new[](std::size_t             size,
+                     std::align_val_t        alignment,
+                     const std::nothrow_t&) noexcept
+{
+    return aoc::allocHooks::allocate(size, std::size_t(alignment));
+}
+
+void operator delete(void *ptr) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t&) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete(void                  *ptr,
+                     std::align_val_t,
+                     const std::nothrow_t&) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+void operator delete[](void                  *ptr,
+                       std::align_val_t,
+                       const std::nothrow_t&) noexcept
+{
+    aoc::allocHooks::deallocate(ptr);
+}
+
+#endif
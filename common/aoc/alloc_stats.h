@@ -0,0 +1,96 @@
+#ifndef INCLUDED_AOC_ALLOC_STATS
+#define INCLUDED_AOC_ALLOC_STATS
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+namespace aoc {
+
+// Process-wide heap counters.  They are maintained by the replacement global
+// 'operator new' and 'operator delete' of <aoc/alloc_hooks.h>, which
+// <aoc/phase.h> pulls in when the program is built with 'AOC_ALLOC_STATS', and
+// stay zero otherwise.  Byte counts are what 'malloc' actually handed out,
+// which is at least what was asked for.
+struct AllocCounters {
+    std::atomic<std::int64_t> d_numAllocs     = 0;
+    std::atomic<std::int64_t> d_allocBytes    = 0;
+    std::atomic<std::int64_t> d_liveBytes     = 0;
+    std::atomic<std::int64_t> d_peakLiveBytes = 0;
+
+    void recordAlloc(std::int64_t bytes)
+    {
+        d_numAllocs.fetch_add(1, std::memory_order_relaxed);
+        d_allocBytes.fetch_add(bytes, std::memory_order_relaxed);
+        const std::int64_t live =
+                  d_liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        std::int64_t peak = d_peakLiveBytes.load(std::memory_order_relaxed);
+        while (peak < live &&
+               !d_peakLiveBytes.compare_exchange_weak(
+                                                peak, live,
+                                                std::memory_order_relaxed)) {
+        }
+    }
+
+    void recordFree(std::int64_t bytes)
+    {
+        d_liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    // Restart peak tracking from the bytes live now.
+    void resetPeak()
+    {
+        d_peakLiveBytes.store(d_liveBytes.load(std::memory_order_relaxed),
+                              std::memory_order_relaxed);
+    }
+};
+
+inline AllocCounters& allocCounters()
+{
+    static AllocCounters counters;
+    return counters;
+}
+
+// Return the value in bytes of the 'field' (e.g. "VmHWM") line of
+// '/proc/self/status', or -1 if it cannot be read.
+inline std::int64_t procStatusBytes(const char *field)
+{
+    std::FILE *const status = std::fopen("/proc/self/status", "r");
+    if (!status)
+        return -1;
+
+    char      line[256];
+    long long kilobytes = -1;
+    const int length    = std::snprintf(nullptr, 0, "%s:", field);
+    while (std::fgets(line, sizeof line, status)) {
+        if (std::string_view(line).starts_with(field) && line[length - 1] == ':') {
+            std::sscanf(line + length, "%lld", &kilobytes);
+            break;
+        }
+    }
+    std::fclose(status);
+    return kilobytes < 0 ? -1 : kilobytes * 1024;
+}
+
+// Restart the kernel's peak resident set size ('VmHWM') from the current
+// one.  Return false if it cannot (before Linux 4.0, or without '/proc'), in
+// which case 'peakRssBytes' keeps reporting the peak since process start.
+inline bool resetPeakRss()
+{
+    std::FILE *const clearRefs = std::fopen("/proc/self/clear_refs", "w");
+    if (!clearRefs)
+        return false;
+
+    const bool done = std::fputs("5", clearRefs) >= 0;
+    return (std::fclose(clearRefs) == 0) && done;
+}
+
+inline std::int64_t peakRssBytes()
+{
+    return procStatusBytes("VmHWM");
+}
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef INCLUDED_AOC_ARENA
+#define INCLUDED_AOC_ARENA
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace aoc {
+
+// Scratch memory for the short-lived containers of one step of a solve (one
+// equation, one design, one update line, ...), reused by every later step
+// on the same thread.  Each step opens an 'ArenaScope' and allocates from its
+// 'resource()', which hands out this thread's buffer monotonically and
+// forgets it all when the scope closes.  A step that outgrows the buffer
+// spills to the heap, and the buffer then grows to what that step needed, so
+// once every thread has seen its largest step (e.g. across a batch of
+// inputs) steps allocate nothing from the heap.  Check with the "allocs" of
+// a phase log from a 'make release ALLOC_STATS=1' build.
+class Arena {
+  public:
+    // Return the calling thread's arena.
+    static Arena& local()
+    {
+        thread_local Arena s_arena;
+        return s_arena;
+    }
+
+  private:
+    friend class ArenaScope;
+
+    std::unique_ptr<std::byte[]> d_buffer;
+    std::size_t                  d_capacity = 0;
+    bool                         d_isOpen   = false;
+};
+
+// One step's use of this thread's 'Arena'.  Scopes do not nest: containers
+// allocated from 'resource()' must be gone before the scope closes, and no
+// other scope may be opened on the thread meanwhile.
+class ArenaScope {
+  public:
+    ArenaScope()
+        : d_arena(Arena::local())
+        , d_resource(d_arena.d_buffer.get(), d_arena.d_capacity, &d_spills)
+    {
+        assert(!d_arena.d_isOpen);
+        d_arena.d_isOpen = true;
+    }
+
+    ArenaScope(const ArenaScope&)            = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    ~ArenaScope()
+    {
+        d_resource.release();
+        if (d_spills.d_numBytes > 0) {
+            d_arena.d_capacity = std::bit_ceil(d_arena.d_capacity +
+                                               d_spills.d_numBytes);
+            d_arena.d_buffer.reset(new std::byte[d_arena.d_capacity]);
+        }
+        d_arena.d_isOpen = false;
+    }
+
+    std::pmr::memory_resource *resource()
+    {
+        return &d_resource;
+    }
+
+  private:
+    // Upstream of the monotonic resource, counting what the buffer lacked.
+    struct SpillResource : std::pmr::memory_resource {
+        std::size_t d_numBytes = 0;
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            d_numBytes += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void        *p,
+                           std::size_t  bytes,
+                           std::size_t  alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(
+                    const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    Arena&                              d_arena;
+    SpillResource                       d_spills;
+    std::pmr::monotonic_buffer_resource d_resource;
+};
+
+} // close namespace aoc
+
+#endif
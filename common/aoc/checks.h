@@ -0,0 +1,225 @@
+#ifndef INCLUDED_AOC_CHECKS
+#define INCLUDED_AOC_CHECKS
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <latch>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <aoc/mapped_file.h>
+#include <aoc/thread_pool.h>
+
+namespace aoc {
+
+// One test of a day, as registered by the 'check' helpers its 'runTests()'
+// calls: its body, the day's source file and the line of the call, and the
+// input location in effect when it was registered.  A check fails by
+// printing to 'failureStream()'.
+struct Check {
+    std::string           d_suite;  // e.g. "day_22-monkey_market-part_1"
+    int                   d_line = 0;
+    std::function<void()> d_body;
+    std::filesystem::path d_inputDirectory;
+    std::filesystem::path d_inputFileOverride;
+};
+
+struct CheckResult {
+    enum Status { e_PASSED, e_FAILED, e_SKIPPED };
+
+    Status       d_status = e_SKIPPED;
+    std::int64_t d_wallNs = 0;
+    std::string  d_failure;  // what the check printed
+};
+
+// Stream that the running check reports its failure to; 'std::cerr' outside
+// of checks.
+inline std::ostream *& failureStream()
+{
+    thread_local std::ostream *stream = &std::cerr;
+    return stream;
+}
+
+// Checks registered on this thread and not yet run.
+inline std::vector<Check>& pendingChecks()
+{
+    thread_local std::vector<Check> checks;
+    return checks;
+}
+
+// Whether the calling thread is running a check.
+inline bool& isInCheck()
+{
+    thread_local bool inCheck = false;
+    return inCheck;
+}
+
+// Whether 'addCheck' registers checks at all.  Programs that call solutions'
+// 'main' over and over, such as the runner and the daemon, turn this off
+// before calling any, so that checks run only in a day's own binary and in
+// the test driver rather than on every request.
+inline bool& checksEnabled()
+{
+    static bool enabled = true;
+    return enabled;
+}
+
+// Register the check 'body' for the line 'lineNumber' of the calling source
+// file, to be run later by 'runPendingChecks' (which 'run' calls) or by a
+// test driver.  A check registered while running another one is part of it,
+// so it runs at once.  Do nothing if '!checksEnabled()'.
+inline void addCheck(int                   lineNumber,
+                     std::function<void()> body,
+                     std::source_location  where =
+                                                std::source_location::current())
+{
+    if (!checksEnabled())
+        return;
+    if (isInCheck()) {
+        body();
+        return;
+    }
+    pendingChecks().push_back({
+        std::filesystem::path(where.file_name()).stem().string(),
+        lineNumber,
+        std::move(body),
+        inputDirectory(),
+        inputFileOverride() });
+}
+
+// Run 'check' on the calling thread with its input location, into 'result',
+// unless 'failed' is already set; set 'failed' if it fails.
+inline void runCheck(const Check&       check,
+                     CheckResult&       result,
+                     std::atomic<bool>& failed)
+{
+    using Clock = std::chrono::steady_clock;
+
+    if (failed.load(std::memory_order_relaxed))
+        return;
+
+    std::ostringstream failure;
+    std::filesystem::path directory = std::exchange(inputDirectory(),
+                                                    check.d_inputDirectory);
+    std::filesystem::path override  = std::exchange(inputFileOverride(),
+                                                    check.d_inputFileOverride);
+    std::ostream *const stream = std::exchange(failureStream(), &failure);
+    isInCheck() = true;
+
+    const auto start = Clock::now();
+    try {
+        check.d_body();
+    }
+    catch (const std::exception& e) {
+        failure << "failure(" << check.d_line << "): " << e.what() << '\n';
+    }
+    result.d_wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+
+    isInCheck()         = false;
+    failureStream()     = stream;
+    inputFileOverride() = std::move(override);
+    inputDirectory()    = std::move(directory);
+
+    result.d_failure = std::move(failure).str();
+    if (result.d_failure.empty()) {
+        result.d_status = CheckResult::e_PASSED;
+    }
+    else {
+        result.d_status = CheckResult::e_FAILED;
+        failed = true;
+    }
+}
+
+// Run 'checks' concurrently on 'pool' and return their results, in the same
+// order.  Once one has failed, those not yet started are skipped.  Must not
+// be called from one of the pool's jobs.
+inline std::vector<CheckResult> runChecks(const std::vector<Check>& checks,
+                                          ThreadPool&               pool)
+{
+    std::vector<CheckResult> results(checks.size());
+    std::atomic<bool>        failed = false;
+    std::latch               done(static_cast<std::ptrdiff_t>(checks.size()));
+    for (std::size_t i = 0; i < checks.size(); ++i) {
+        pool.submit([&, i] {
+            runCheck(checks[i], results[i], failed);
+            done.count_down();
+        });
+    }
+    done.wait();
+    return results;
+}
+
+// Print the failures among 'results' on 'std::cerr' and append one line per
+// check to the file named by the 'AOC_TEST_LOG' environment variable, if it
+// is set: "SUITE\tline=N\tstatus=passed|failed|skipped\twall_ns=N".  Return
+// whether none failed.
+inline bool reportChecks(const std::vector<Check>&       checks,
+                         const std::vector<CheckResult>& results)
+{
+    static std::mutex s_mutex;  // solutions may run side by side (see 'run')
+    std::lock_guard   lock(s_mutex);
+
+    bool passed = true;
+    for (const CheckResult& result : results) {
+        if (result.d_status == CheckResult::e_FAILED) {
+            std::cerr << result.d_failure << std::flush;
+            passed = false;
+        }
+    }
+
+    static const char *const s_logPath = std::getenv("AOC_TEST_LOG");
+    if (!s_logPath)
+        return passed;
+    if (std::FILE *const log = std::fopen(s_logPath, "a")) {
+        static const char *const k_StatusNames[] = {
+            "passed", "failed", "skipped"
+        };
+        for (std::size_t i = 0; i < checks.size(); ++i) {
+            std::fprintf(log, "%s\tline=%d\tstatus=%s\twall_ns=%lld\n",
+                         checks[i].d_suite.c_str(),
+                         checks[i].d_line,
+                         k_StatusNames[results[i].d_status],
+                         static_cast<long long>(results[i].d_wallNs));
+        }
+        std::fclose(log);
+    }
+    return passed;
+}
+
+// Run the checks registered on this thread so far, concurrently, report them
+// as 'reportChecks' does, and forget them.  Return whether none failed.
+inline bool runPendingChecks()
+{
+    const std::vector<Check> checks = std::exchange(pendingChecks(), {});
+    if (checks.empty())
+        return true;
+
+    std::vector<CheckResult> results(checks.size());
+    if (checks.size() == 1) {
+        std::atomic<bool> failed = false;
+        runCheck(checks.front(), results.front(), failed);
+    }
+    else {
+        static ThreadPool s_pool;
+        results = runChecks(checks, s_pool);
+    }
+    return reportChecks(checks, results);
+}
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef INCLUDED_AOC_DIGEST
+#define INCLUDED_AOC_DIGEST
+
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace aoc {
+
+// 128-bit content digest, for keying cached results by what they were
+// computed from.  Not cryptographic: it guards against accidental collisions
+// only.
+struct Digest {
+    std::uint64_t d_hi = 0;
+    std::uint64_t d_lo = 0;
+
+    auto operator<=>(const Digest&) const = default;
+
+    // Return the 32 lowercase hex digits of this digest.
+    std::string hex() const
+    {
+        static constexpr char k_Digits[] = "0123456789abcdef";
+        std::string text(32, '0');
+        for (int i = 0; i < 16; ++i) {
+            text[15 - i] = k_Digits[(d_hi >> (4 * i)) & 0xf];
+            text[31 - i] = k_Digits[(d_lo >> (4 * i)) & 0xf];
+        }
+        return text;
+    }
+};
+
+struct DigestHash {
+    std::size_t operator()(const Digest& digest) const noexcept
+    {
+        return digest.d_lo;
+    }
+};
+
+// Accumulates a 'Digest' over a sequence of byte strings and values.  Each
+// addition is length-delimited, so '"ab", "c"' and '"a", "bc"' differ.
+class Hasher {
+    static constexpr std::uint64_t k_Mul1 = 0x9e3779b97f4a7c15,
+                                   k_Mul2 = 0xc2b2ae3d27d4eb4f;
+
+    static std::uint64_t mix(std::uint64_t x)
+    {
+        x ^= x >> 30, x *= 0xbf58476d1ce4e5b9;
+        x ^= x >> 27, x *= 0x94d049bb133111eb;
+        return x ^ (x >> 31);
+    }
+
+    Digest d_state;
+
+  public:
+    Hasher() = default;
+
+    // Continue from 'digest', as if its additions had been made here.
+    explicit Hasher(const Digest& digest)
+        : d_state(digest)
+    {
+    }
+
+    Hasher& add(std::string_view bytes)
+    {
+        std::uint64_t a = d_state.d_hi ^ k_Mul1,
+                      b = d_state.d_lo ^ k_Mul2 ^ bytes.size();
+        const char   *p = bytes.data();
+        for (std::size_t n = bytes.size(); ; n -= 8, p += 8) {
+            std::uint64_t word = 0;
+            std::memcpy(&word, p, n < 8 ? n : 8);
+            a = std::rotl((a ^ word) * k_Mul1, 29);
+            b = std::rotl(b + word, 31) * k_Mul2 ^ a;
+            if (n <= 8)
+                break;
+        }
+        d_state = { mix(a + mix(b)), mix(b ^ a) };
+        return *this;
+    }
+
+    template <class TYPE>
+        requires std::is_trivially_copyable_v<TYPE>
+    Hasher& add(std::span<const TYPE> values)
+    {
+        return add(std::string_view(
+                           reinterpret_cast<const char *>(values.data()),
+                           values.size_bytes()));
+    }
+
+    template <class TYPE>
+        requires std::is_arithmetic_v<TYPE>
+    Hasher& add(TYPE value)
+    {
+        return add(std::span<const TYPE>(&value, 1));
+    }
+
+    Digest digest() const
+    {
+        return d_state;
+    }
+};
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef INCLUDED_AOC_EMBEDDED_INPUT
+#define INCLUDED_AOC_EMBEDDED_INPUT
+
+// Puzzle input compiled into the binary by 'make embed' (see
+// <release.mk>), which defines 'AOC_EMBEDDED_INPUT' as the path of a header
+// generated by 'embed.sh'.  That header defines 'AOC_EMBEDDED_INPUT_NAME', the
+// input's file name, and 'AOC_EMBEDDED_INPUT_BYTES', its bytes as a list of
+// character literals.  'MappedFile' serves the file of that name from these
+// bytes instead of opening it, and solutions may parse them in constant
+// expressions, down to computing their answer at compile time.
+
+#include <string_view>
+
+#ifdef AOC_EMBEDDED_INPUT
+#include AOC_EMBEDDED_INPUT
+#endif
+
+namespace aoc {
+
+#ifdef AOC_EMBEDDED_INPUT
+inline constexpr char k_EmbeddedInputBytes[] = { AOC_EMBEDDED_INPUT_BYTES };
+#endif
+
+// Return the embedded input's file name, or empty if there is none.
+constexpr std::string_view embeddedInputName()
+{
+#ifdef AOC_EMBEDDED_INPUT
+    return AOC_EMBEDDED_INPUT_NAME;
+#else
+    return {};
+#endif
+}
+
+// Return the embedded input's bytes, or empty if there are none.
+constexpr std::string_view embeddedInput()
+{
+#ifdef AOC_EMBEDDED_INPUT
+    return { k_EmbeddedInputBytes, sizeof k_EmbeddedInputBytes };
+#else
+    return {};
+#endif
+}
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,218 @@
+#ifndef INCLUDED_AOC_GRID
+#define INCLUDED_AOC_GRID
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Geometry shared by 'Grid' and 'BitGrid': 'numRows() x numCols()' cells
+// stored row-major inside a border that is 'padding()' cells wide on every
+// side.  Cells are addressed by a linear 'Index', so a neighbor is one
+// addition away and walking off the edge lands on a border cell rather than
+// out of bounds.
+class GridShape {
+  public:
+    using Index = std::ptrdiff_t;
+
+    GridShape() = default;
+
+    GridShape(Index numRows, Index numCols, Index padding)
+        : d_numRows(numRows)
+        , d_numCols(numCols)
+        , d_padding(padding)
+        , d_stride(numCols + 2*padding)
+    {
+        assert(numRows >= 0);
+        assert(numCols >= 0);
+        assert(padding >= 0);
+    }
+
+    Index numRows() const { return d_numRows; }
+    Index numCols() const { return d_numCols; }
+    Index padding() const { return d_padding; }
+
+    // Distance between vertically adjacent cells.
+    Index stride() const { return d_stride; }
+
+    // Number of cells including the border.
+    Index size() const { return (d_numRows + 2*d_padding) * d_stride; }
+
+    Index index(Index row, Index col) const
+    {
+        return (row + d_padding) * d_stride + (col + d_padding);
+    }
+
+    Index row(Index index) const { return index / d_stride - d_padding; }
+    Index col(Index index) const { return index % d_stride - d_padding; }
+
+    // Offsets of the right, down, left and up neighbors.
+    std::array<Index, 4> neighbors() const
+    {
+        return { +1, +d_stride, -1, -d_stride };
+    }
+
+    // Offsets of all eight neighbors, clockwise from the right one.
+    std::array<Index, 8> neighbors8() const
+    {
+        return { +1, +d_stride + 1, +d_stride, +d_stride - 1,
+                 -1, -d_stride - 1, -d_stride, -d_stride + 1 };
+    }
+
+  private:
+    Index d_numRows = 0;
+    Index d_numCols = 0;
+    Index d_padding = 0;
+    Index d_stride  = 0;
+};
+
+// Contiguous grid of 'T' surrounded by a border of sentinel cells.  Use
+// 'Grid<std::uint8_t>' (or 'BitGrid') for flags; 'Grid<bool>' would get the
+// 'std::vector<bool>' proxies this type exists to avoid.
+template <class T>
+class Grid : public GridShape {
+    static_assert(!std::is_same_v<T, bool>,
+                  "use 'Grid<std::uint8_t>' or 'BitGrid' for flags");
+
+  public:
+    Grid() = default;
+
+    Grid(Index    numRows,
+         Index    numCols,
+         const T& value,
+         const T& border,
+         Index    padding = 1)
+        : GridShape(numRows, numCols, padding)
+        , d_cells(size(), border)
+    {
+        fill(value);
+    }
+
+    // A grid of the same shape as 'other'.
+    Grid(const GridShape& other, const T& value, const T& border)
+        : Grid(other.numRows(), other.numCols(), value, border,
+               other.padding())
+    {
+    }
+
+    // Return a grid whose rows are the equally long ranges in 'rows' (e.g.
+    // the lines of an input file).
+    template <class ROWS>
+    static Grid fromRows(const ROWS& rows, const T& border, Index padding = 1)
+    {
+        Index numRows = 0, numCols = 0;
+        for (const auto& row : rows)
+            numCols = std::ranges::ssize(row), ++numRows;
+
+        Grid grid(numRows, numCols, border, border, padding);
+        Index i = 0;
+        for (const auto& row : rows) {
+            assert(std::ranges::ssize(row) == numCols);
+            std::ranges::copy(row, grid.rowCells(i++).begin());
+        }
+        return grid;
+    }
+
+    T&       operator[](Index index)       { return d_cells[index]; }
+    const T& operator[](Index index) const { return d_cells[index]; }
+
+    T& operator()(Index row, Index col)
+    {
+        return d_cells[index(row, col)];
+    }
+
+    const T& operator()(Index row, Index col) const
+    {
+        return d_cells[index(row, col)];
+    }
+
+    // The 'numCols()' cells of 'row', without the border.
+    std::span<T> rowCells(Index row)
+    {
+        return { d_cells.data() + index(row, 0),
+                 static_cast<std::size_t>(numCols()) };
+    }
+
+    std::span<const T> rowCells(Index row) const
+    {
+        return { d_cells.data() + index(row, 0),
+                 static_cast<std::size_t>(numCols()) };
+    }
+
+    // Set every cell, but not the border, to 'value'.
+    void fill(const T& value)
+    {
+        for (Index i = 0; i < numRows(); ++i)
+            std::ranges::fill(rowCells(i), value);
+    }
+
+    // Return the index of the first cell equal to 'value', or -1.
+    Index find(const T& value) const
+    {
+        for (Index i = 0; i < numRows(); ++i) {
+            const auto cells = rowCells(i);
+            if (const auto it = std::ranges::find(cells, value);
+                it != cells.end())
+                return index(i, it - cells.begin());
+        }
+        return -1;
+    }
+
+  private:
+    std::vector<T> d_cells;
+};
+
+// One bit per cell, in the same layout as a 'Grid' of the same shape so that
+// both can be addressed by the same 'Index'.
+class BitGrid : public GridShape {
+  public:
+    BitGrid() = default;
+
+    BitGrid(Index numRows, Index numCols, bool border = false,
+            Index padding = 1)
+        : GridShape(numRows, numCols, padding)
+        , d_words((size() + 63) / 64)
+    {
+        if (border) {
+            for (Index i = 0; i < size(); ++i)
+                set(i);
+            for (Index i = 0; i < numRows; ++i)
+                for (Index j = 0; j < numCols; ++j)
+                    reset(index(i, j));
+        }
+    }
+
+    explicit BitGrid(const GridShape& other, bool border = false)
+        : BitGrid(other.numRows(), other.numCols(), border, other.padding())
+    {
+    }
+
+    bool test(Index index) const
+    {
+        return (d_words[index >> 6] >> (index & 63)) & 1;
+    }
+
+    void set(Index index)
+    {
+        d_words[index >> 6] |= std::uint64_t(1) << (index & 63);
+    }
+
+    void reset(Index index)
+    {
+        d_words[index >> 6] &= ~(std::uint64_t(1) << (index & 63));
+    }
+
+  private:
+    std::vector<std::uint64_t> d_words;
+};
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef INCLUDED_AOC_GRID_SEARCH
+#define INCLUDED_AOC_GRID_SEARCH
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <aoc/aho_corasick.h>
+
+namespace aoc {
+
+// Step from one cell of a line of a grid to the next.
+struct Direction {
+    int d_row;
+    int d_col;
+};
+
+// The eight directions, clockwise from rightwards (as 'neighbors8' in
+// <aoc/grid.h>), and the four diagonal ones.
+inline constexpr std::array<Direction, 8> k_AllDirections = {{
+    { 0, +1 }, { +1, +1 }, { +1, 0 }, { +1, -1 },
+    { 0, -1 }, { -1, -1 }, { -1, 0 }, { -1, +1 },
+}};
+inline constexpr std::array<Direction, 4> k_DiagonalDirections = {{
+    { +1, +1 }, { +1, -1 }, { -1, -1 }, { -1, +1 },
+}};
+
+// Find every occurrence of the words of 'automaton' in the rectangular grid
+// 'rows' that reads in one of 'directions', and call 'visit(word, row, col,
+// direction)' for each with the cell of its first character.  Each direction
+// streams its family of lines (e.g. every column top to bottom) through the
+// automaton at once, a row at a time in memory order, carrying each line's
+// state over from the row before.  So the search takes one step per cell and
+// direction, whatever the number and length of the words.
+template <class VISITOR>
+void searchGrid(std::span<const std::string> rows,
+                const AhoCorasick&           automaton,
+                std::span<const Direction>   directions,
+                VISITOR&&                    visit)
+{
+    const int numRows = rows.size(),
+              numCols = rows.empty() ? 0 : rows[0].size();
+
+    std::vector<AhoCorasick::State> prevStates(numCols), states(numCols);
+    for (const Direction& direction : directions) {
+        const auto [dRow, dCol] = direction;
+        assert(dRow || dCol);
+
+        const auto step = [&](AhoCorasick::State state, int row, int col) {
+            state = automaton.next(state, rows[row][col]);
+            for (const std::uint32_t word : automaton.matches(state)) {
+                const int back = automaton.wordLength(word) - 1;
+                visit(word, row - back * dRow, col - back * dCol, direction);
+            }
+            return state;
+        };
+
+        if (!dRow) {
+            for (int row = 0; row < numRows; ++row) {
+                AhoCorasick::State state = automaton.start();
+                for (int i = 0; i < numCols; ++i)
+                    state = step(state, row, dCol > 0 ? i : numCols - 1 - i);
+            }
+            continue;
+        }
+
+        std::ranges::fill(prevStates, automaton.start());
+        for (int i = 0; i < numRows; ++i) {
+            const int row = dRow > 0 ? i : numRows - 1 - i;
+            assert(rows[row].size() == std::size_t(numCols));
+            for (int col = 0; col < numCols; ++col) {
+                const int from = col - dCol;
+                states[col] = step((from >= 0) && (from < numCols)
+                                   ? prevStates[from]
+                                   : automaton.start(),
+                                   row,
+                                   col);
+            }
+            std::swap(prevStates, states);
+        }
+    }
+}
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef INCLUDED_AOC_LINE_READER
+#define INCLUDED_AOC_LINE_READER
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <aoc/embedded_input.h>
+#include <aoc/mapped_file.h>
+
+namespace aoc {
+
+// Single-pass range over the lines of a file, read through a fixed-size
+// buffer rather than mapped whole, so that a solution folding its input line
+// by line runs in constant memory however large the file (or pipe, e.g.
+// '/dev/stdin') is.  The buffer only grows to hold a line longer than
+// itself.  Lines are split as by 'Lines', and each is valid until the next
+// one is read.  The file is found as 'MappedFile' finds it, embedded inputs
+// included, but it is not folded into 'mappedInputDigest()'.
+class LineReader {
+  public:
+    static constexpr std::size_t k_DefaultBufferSize = 64 * 1024;
+
+    class iterator {
+      public:
+        using value_type      = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        explicit iterator(LineReader *reader)
+            : d_reader(reader)
+        {
+            ++*this;
+        }
+
+        std::string_view operator*() const
+        {
+            return d_line;
+        }
+
+        iterator& operator++()
+        {
+            if (const std::optional<std::string_view> line = d_reader->next())
+                d_line = *line;
+            else
+                d_reader = nullptr;
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(std::default_sentinel_t) const
+        {
+            return !d_reader;
+        }
+
+      private:
+        LineReader       *d_reader = nullptr;
+        std::string_view  d_line;
+    };
+
+    explicit LineReader(const std::filesystem::path& relativePath,
+                        std::size_t bufferSize = k_DefaultBufferSize)
+    {
+        if (inputFileOverride().empty() && !embeddedInputName().empty() &&
+            relativePath.filename() == embeddedInputName()) {
+            d_unread = embeddedInput();
+            return;
+        }
+
+        const std::filesystem::path path =
+                                  inputFileOverride().empty()
+                                ? inputDirectory() / relativePath
+                                : inputFileOverride();
+        d_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (d_fd < 0) {
+            std::cerr << "Failed to open " << path << ": "
+                      << std::strerror(errno) << std::endl;
+            std::abort();
+        }
+        ::posix_fadvise(d_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        d_buffer.resize(bufferSize);
+    }
+
+    LineReader(const LineReader&)            = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    ~LineReader()
+    {
+        if (d_fd >= 0)
+            ::close(d_fd);
+    }
+
+    // Return the next line, or nothing once all have been read.
+    std::optional<std::string_view> next()
+    {
+        for (;;) {
+            if (const auto end = d_unread.find('\n');
+                end != std::string_view::npos) {
+                const std::string_view line = d_unread.substr(0, end);
+                d_unread.remove_prefix(end + 1);
+                return line;
+            }
+            if (!refill()) {
+                if (d_unread.empty())
+                    return std::nullopt;
+                return std::exchange(d_unread, {});
+            }
+        }
+    }
+
+    iterator begin()
+    {
+        return iterator(this);
+    }
+
+    std::default_sentinel_t end() const
+    {
+        return {};
+    }
+
+  private:
+    // Move the unread bytes to the front of the buffer and read more after
+    // them, growing the buffer if they fill it.  Return false at end of file.
+    bool refill()
+    {
+        if (d_fd < 0)
+            return false;
+
+        const std::size_t numUnread = d_unread.size();
+        if (numUnread == d_buffer.size())
+            d_buffer.resize(2 * d_buffer.size());
+        else if (numUnread > 0)
+            std::memmove(d_buffer.data(), d_unread.data(), numUnread);
+
+        ssize_t numRead;
+        do {
+            numRead = ::read(d_fd, d_buffer.data() + numUnread,
+                             d_buffer.size() - numUnread);
+        } while (numRead < 0 && errno == EINTR);
+        if (numRead < 0) {
+            std::cerr << "Failed to read input: " << std::strerror(errno)
+                      << std::endl;
+            std::abort();
+        }
+        d_unread = { d_buffer.data(), numUnread + std::size_t(numRead) };
+        if (numRead == 0) {
+            ::close(std::exchange(d_fd, -1));
+            return false;
+        }
+        return true;
+    }
+
+    int               d_fd = -1;
+    std::vector<char> d_buffer;
+    std::string_view  d_unread;
+};
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,268 @@
+#ifndef INCLUDED_AOC_MAPPED_FILE
+#define INCLUDED_AOC_MAPPED_FILE
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <aoc/digest.h>
+#include <aoc/embedded_input.h>
+
+namespace aoc {
+
+// Absolute directory against which this thread resolves relative input paths,
+// or empty for the process's working directory.  Lets one process run several days'
+// solutions concurrently, each reading its own inputs.
+inline std::filesystem::path& inputDirectory()
+{
+    thread_local std::filesystem::path directory;
+    return directory;
+}
+
+// File that this thread's solution reads as its puzzle input instead of the
+// one it names, or empty.  Lets one process solve many inputs concurrently
+// with the same solution (see 'aoc::run').
+inline std::filesystem::path& inputFileOverride()
+{
+    thread_local std::filesystem::path path;
+    return path;
+}
+
+// While engaged, every file mapped on this thread is folded into this digest,
+// which thereby identifies the input a solution read (see 'aoc::run').
+inline std::optional<Digest>& mappedInputDigest()
+{
+    thread_local std::optional<Digest> digest;
+    return digest;
+}
+
+// Read-only view of a whole file backed by a private memory mapping.  The
+// bytes stay valid for the lifetime of the 'MappedFile', so parsers can hand
+// out 'std::string_view's into it instead of copying lines onto the heap.
+// Solutions map only their puzzle input, so while this thread has an
+// 'inputFileOverride()' that file is mapped whatever path is given.  Failing
+// that, an 'embeddedInput()' named by 'relativePath' is viewed in place.
+class MappedFile {
+  public:
+    explicit MappedFile(const std::filesystem::path& relativePath)
+    {
+        if (inputFileOverride().empty() && !embeddedInputName().empty() &&
+            relativePath.filename() == embeddedInputName()) {
+            d_data = embeddedInput().data();
+            d_size = embeddedInput().size();
+            if (std::optional<Digest>& digest = mappedInputDigest())
+                digest = Hasher(*digest).add(view()).digest();
+            return;
+        }
+
+        const std::filesystem::path path =
+                                  inputFileOverride().empty()
+                                ? inputDirectory() / relativePath
+                                : inputFileOverride();
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            fail(path, "open");
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            fail(path, "fstat");
+        }
+        d_size = static_cast<std::size_t>(info.st_size);
+        if (d_size > 0) {
+            void *const addr = ::mmap(nullptr, d_size, PROT_READ, MAP_PRIVATE,
+                                      fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                fail(path, "mmap");
+            }
+            // Advice values are not flags: give each one separately.
+            ::madvise(addr, d_size, MADV_SEQUENTIAL);
+            ::madvise(addr, d_size, MADV_WILLNEED);
+            d_data = static_cast<const char *>(addr);
+        }
+        ::close(fd);
+        if (std::optional<Digest>& digest = mappedInputDigest())
+            digest = Hasher(*digest).add(view()).digest();
+    }
+
+    MappedFile(MappedFile&& other) noexcept
+        : d_data(std::exchange(other.d_data, nullptr))
+        , d_size(std::exchange(other.d_size, 0))
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        std::swap(d_data, other.d_data);
+        std::swap(d_size, other.d_size);
+        return *this;
+    }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if (d_data && d_data != embeddedInput().data())
+            ::munmap(const_cast<char *>(d_data), d_size);
+    }
+
+    std::span<const char> bytes() const
+    {
+        return { data(), d_size };
+    }
+
+    std::string_view view() const
+    {
+        return { data(), d_size };
+    }
+
+  private:
+    [[noreturn]] static void fail(const std::filesystem::path& path,
+                                  const char                  *what)
+    {
+        std::cerr << "Failed to " << what << ' ' << path << ": "
+                  << std::strerror(errno) << std::endl;
+        std::abort();
+    }
+
+    const char *data() const
+    {
+        return d_data ? d_data : "";
+    }
+
+    const char  *d_data = nullptr;
+    std::size_t  d_size = 0;
+};
+
+// Forward range over the '\n'-terminated lines of 'text', without the
+// terminators.  A missing final newline is tolerated and no empty trailing
+// line is produced.
+class Lines {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const std::string_view *;
+        using reference         = std::string_view;
+
+        constexpr iterator() = default;
+
+        constexpr explicit iterator(std::string_view rest)
+            : d_rest(rest)
+        {
+            advance();
+        }
+
+        constexpr std::string_view operator*() const
+        {
+            return d_line;
+        }
+
+        constexpr iterator& operator++()
+        {
+            advance();
+            return *this;
+        }
+
+        constexpr iterator operator++(int)
+        {
+            iterator prev = *this;
+            advance();
+            return prev;
+        }
+
+        constexpr bool operator==(const iterator& other) const
+        {
+            return d_line.data() == other.d_line.data();
+        }
+
+      private:
+        constexpr void advance()
+        {
+            if (d_rest.empty()) {
+                d_line = {};
+                return;
+            }
+            const auto eol = d_rest.find('\n');
+            d_line = d_rest.substr(0, eol);
+            d_rest.remove_prefix(eol == d_rest.npos ? d_rest.size() : eol+1);
+        }
+
+        std::string_view d_rest, d_line;
+    };
+
+    constexpr explicit Lines(std::string_view text)
+        : d_text(text)
+    {
+    }
+
+    constexpr iterator begin() const
+    {
+        return iterator(d_text);
+    }
+
+    constexpr iterator end() const
+    {
+        return {};
+    }
+
+  private:
+    std::string_view d_text;
+};
+
+constexpr Lines lines(std::string_view text)
+{
+    return Lines(text);
+}
+
+inline std::vector<std::string_view> splitLines(std::string_view text)
+{
+    const auto range = lines(text);
+    return { range.begin(), range.end() };
+}
+
+// Return the first regular file in 'directory' (by default this thread's
+// 'inputDirectory()') whose name ends with 'suffix', aborting when there is
+// none.  This thread's 'inputFileOverride()', if any, is returned instead,
+// and failing that, when no 'directory' is given, the 'embeddedInputName()'
+// if it ends with 'suffix'.
+inline std::filesystem::path findInputFile(
+                                std::string_view      suffix = "-input.txt",
+                                std::filesystem::path directory = {})
+{
+    if (!inputFileOverride().empty())
+        return inputFileOverride();
+    if (directory.empty() && embeddedInputName().ends_with(suffix))
+        return embeddedInputName();
+    if (directory.empty())
+        directory = inputDirectory().empty() ? "." : inputDirectory();
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.is_regular_file() &&
+            entry.path().filename().string().ends_with(suffix))
+            return entry.path();
+    }
+    std::cerr << "Failed to find input file in " << directory << std::endl;
+    std::abort();
+}
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef INCLUDED_AOC_PERF_COUNTERS
+#define INCLUDED_AOC_PERF_COUNTERS
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace aoc {
+
+// Hardware event counts; -1 for events that could not be counted.
+struct PerfCounts {
+    std::int64_t d_cycles       = -1;
+    std::int64_t d_instructions = -1;
+    std::int64_t d_cacheMisses  = -1;
+    std::int64_t d_branchMisses = -1;
+};
+
+// Scoped hardware performance counters: count user-space cycles,
+// instructions, last-level cache misses and branch misses of the calling
+// thread, and of the threads it starts, from construction until destruction.
+// 'perf_event_open' fails without a PMU (e.g. in most VMs and containers) or
+// when 'kernel.perf_event_paranoid' forbids it; the affected counts are then
+// -1 and the program runs on unaffected.
+//..
+//  aoc::PerfCounters counters;
+//  solve(input);
+//  const aoc::PerfCounts counts = counters.read();
+//..
+class PerfCounters {
+    static constexpr std::array<std::uint64_t, 4> k_Events = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+
+    std::array<int, k_Events.size()> d_fds;
+
+    // Return the count of the event open as 'fd', extrapolated over the time
+    // the kernel had to multiplex it off the PMU, or -1 if it is not open or
+    // never ran.
+    static std::int64_t readEvent(int fd)
+    {
+        std::uint64_t values[3];  // count, time enabled, time running
+        if (fd < 0 || ::read(fd, values, sizeof values) != sizeof values ||
+            values[2] == 0)
+            return -1;
+        if (values[1] == values[2])
+            return values[0];
+        return static_cast<std::int64_t>(
+                         static_cast<double>(values[0]) * values[1] / values[2]);
+    }
+
+  public:
+    PerfCounters()
+    {
+        for (std::size_t i = 0; i < k_Events.size(); ++i) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof attr);
+            attr.size           = sizeof attr;
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.config         = k_Events[i];
+            attr.disabled       = 1;
+            attr.inherit        = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                  PERF_FORMAT_TOTAL_TIME_RUNNING;
+            d_fds[i] = static_cast<int>(
+                         ::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+        // Start them together, after the slow part.
+        for (const int fd : d_fds) {
+            if (fd >= 0)
+                ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters()
+    {
+        for (const int fd : d_fds) {
+            if (fd >= 0)
+                ::close(fd);
+        }
+    }
+
+    // Return whether any event is being counted.
+    bool isAvailable() const
+    {
+        for (const int fd : d_fds) {
+            if (fd >= 0)
+                return true;
+        }
+        return false;
+    }
+
+    // Return the counts so far.
+    PerfCounts read() const
+    {
+        return { readEvent(d_fds[0]), readEvent(d_fds[1]),
+                 readEvent(d_fds[2]), readEvent(d_fds[3]) };
+    }
+};
+
+} // close namespace aoc
+
+#endif
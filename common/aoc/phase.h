@@ -0,0 +1,125 @@
+#ifndef INCLUDED_AOC_PHASE
+#define INCLUDED_AOC_PHASE
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <aoc/alloc_stats.h>
+#include <aoc/perf_counters.h>
+
+#ifdef AOC_ALLOC_STATS
+#include <aoc/alloc_hooks.h>
+#endif
+
+namespace aoc {
+
+// Measurements taken around one named phase of a run ("getInput", "solve").
+// The memory figures are process-wide and -1 when not measured: the heap
+// ones need a build with 'AOC_ALLOC_STATS' (see <aoc/alloc_hooks.h>), the
+// resident set size needs '/proc'.  Peaks include what was already live when
+// the phase began (e.g. the parsed input, during "solve").  The hardware
+// counts are those of 'PerfCounters'.
+struct PhaseStats {
+    std::string_view d_name;
+    std::int64_t     d_wallNs        = 0;
+    PerfCounts       d_counts;
+    std::int64_t     d_numAllocs     = -1;  // allocations during the phase
+    std::int64_t     d_allocBytes    = -1;  // bytes they took
+    std::int64_t     d_peakHeapBytes = -1;  // most heap bytes live at once
+    std::int64_t     d_peakRssBytes  = -1;  // highest resident set size
+};
+
+// Return the file named by the 'AOC_PHASE_LOG' environment variable, or null
+// if it is unset.
+inline const char *phaseLogPath()
+{
+    static const char *const s_logPath = std::getenv("AOC_PHASE_LOG");
+    return s_logPath;
+}
+
+// Append 'stats' as one tab-separated 'key=value' line to 'phaseLogPath()',
+// leaving out the figures that were not measured.  Nothing is written
+// when there is no log, so normal runs print only the answer.
+inline void reportPhase(const PhaseStats& stats)
+{
+    if (!phaseLogPath())
+        return;
+
+    if (std::FILE *const log = std::fopen(phaseLogPath(), "a")) {
+        std::fprintf(log, "%.*s\twall_ns=%lld",
+                     static_cast<int>(stats.d_name.size()),
+                     stats.d_name.data(),
+                     static_cast<long long>(stats.d_wallNs));
+        const std::pair<const char *, std::int64_t> optional[] = {
+            { "cycles",          stats.d_counts.d_cycles       },
+            { "instructions",    stats.d_counts.d_instructions },
+            { "cache_misses",    stats.d_counts.d_cacheMisses  },
+            { "branch_misses",   stats.d_counts.d_branchMisses },
+            { "allocs",          stats.d_numAllocs             },
+            { "alloc_bytes",     stats.d_allocBytes            },
+            { "peak_heap_bytes", stats.d_peakHeapBytes         },
+            { "peak_rss_bytes",  stats.d_peakRssBytes          },
+        };
+        for (const auto& [key, value] : optional) {
+            if (value >= 0)
+                std::fprintf(log, "\t%s=%lld", key,
+                             static_cast<long long>(value));
+        }
+        std::fputc('\n', log);
+        std::fclose(log);
+    }
+}
+
+// Invoke 'func', report how long it took under 'name', and return its result.
+// While a phase log is being written, also report the memory the call used
+// and its hardware event counts; these are set up and sampled outside the
+// timed region.
+template <class FUNC>
+auto phase(std::string_view name, FUNC&& func)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const bool     measure = phaseLogPath() != nullptr;
+    AllocCounters& heap    = allocCounters();
+    [[maybe_unused]] std::int64_t allocs = 0, allocBytes = 0;
+    if (measure) {
+        resetPeakRss();
+        heap.resetPeak();
+        allocs     = heap.d_numAllocs.load(std::memory_order_relaxed);
+        allocBytes = heap.d_allocBytes.load(std::memory_order_relaxed);
+    }
+    std::optional<PerfCounters> counters;
+    if (measure)
+        counters.emplace();
+
+    PhaseStats stats{ name };
+    const auto start  = Clock::now();
+    auto       result = std::forward<FUNC>(func)();
+    const auto end    = Clock::now();
+    stats.d_wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                         end - start).count();
+    if (measure) {
+        stats.d_counts = counters->read();
+        counters.reset();
+#ifdef AOC_ALLOC_STATS
+        stats.d_numAllocs  = heap.d_numAllocs.load(std::memory_order_relaxed) -
+                             allocs;
+        stats.d_allocBytes = heap.d_allocBytes.load(std::memory_order_relaxed) -
+                             allocBytes;
+        stats.d_peakHeapBytes =
+                           heap.d_peakLiveBytes.load(std::memory_order_relaxed);
+#endif
+        stats.d_peakRssBytes = peakRssBytes();
+    }
+    reportPhase(stats);
+    return result;
+}
+
+} // close namespace aoc
+
+#endif
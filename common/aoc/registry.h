@@ -0,0 +1,37 @@
+#ifndef INCLUDED_AOC_REGISTRY
+#define INCLUDED_AOC_REGISTRY
+
+#include <string_view>
+#include <vector>
+
+namespace aoc {
+
+// One day's part as linked into a multi-solution driver: its calendar
+// coordinates, its directory relative to the repository root (where its
+// inputs live), its 'main', and its 'runTests', if it has one.
+struct Solution {
+    int               d_year = 0, d_day = 0, d_part = 0;
+    std::string_view  d_name;
+    std::string_view  d_directory;
+    int             (*d_main)(int, char *[]) = nullptr;
+    void            (*d_runTests)()          = nullptr;
+};
+
+// Every solution registered so far, in static-initialization order.
+inline std::vector<Solution>& registry()
+{
+    static std::vector<Solution> s_solutions;
+    return s_solutions;
+}
+
+// Add a solution to the 'registry()' during static initialization.
+struct Registration {
+    explicit Registration(const Solution& solution)
+    {
+        registry().push_back(solution);
+    }
+};
+
+} // close namespace aoc
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef INCLUDED_AOC_RESULT_CACHE
+#define INCLUDED_AOC_RESULT_CACHE
+
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <aoc/digest.h>
+
+namespace aoc {
+
+// Directory holding the on-disk result caches: '$AOC_CACHE_DIR', or empty
+// when that is unset, which turns all caching off.
+inline const std::filesystem::path& cacheDirectory()
+{
+    static const std::filesystem::path s_directory = [] {
+        const char *const directory = std::getenv("AOC_CACHE_DIR");
+        return std::filesystem::path(directory ? directory : "");
+    }();
+    return s_directory;
+}
+
+// Persistent map from the 'Digest' of what a result was computed from to the
+// result, shared by every run of the program.  Each cache is one append-only
+// file '<name>@<version>.tsv' in 'cacheDirectory()' of 'KEY<tab>VALUE' lines,
+// loaded in full on construction; bump 'version' whenever the computation
+// changes, which leaves the stale file behind.  Lines are appended with
+// single 'write's to an 'O_APPEND' descriptor, so concurrent processes may
+// share a cache, and the object itself may be shared by threads.  Values
+// must not contain tabs or newlines.
+class ResultCache {
+  public:
+    // Open the cache of 'name' (e.g. "2025/10-part_2") at 'version', or
+    // leave it disabled if caching is off or the file cannot be opened.
+    ResultCache(std::string_view name, std::string_view version)
+    {
+        if (cacheDirectory().empty())
+            return;
+
+        std::string fileName(name);
+        for (char& c : fileName) {
+            if (c == '/')
+                c = '_';
+        }
+        fileName.append("@").append(version).append(".tsv");
+        const std::filesystem::path path = cacheDirectory() / fileName;
+
+        std::error_code error;
+        std::filesystem::create_directories(cacheDirectory(), error);
+        d_fd = ::open(path.c_str(), O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC,
+                      0644);
+        if (d_fd < 0) {
+            std::cerr << "Result cache " << path << " disabled: "
+                      << std::strerror(errno) << std::endl;
+            return;
+        }
+        std::ifstream stream(path);
+        for (std::string line; std::getline(stream, line); ) {
+            if (line.find('\t') != 32)
+                continue;  // e.g. torn by a crashed writer
+
+            Digest key;
+            const char *const hex = line.data();
+            if (std::from_chars(hex, hex + 16, key.d_hi, 16).ptr != hex + 16 ||
+                std::from_chars(hex + 16, hex + 32, key.d_lo, 16).ptr !=
+                                                                     hex + 32)
+                continue;
+            d_entries.insert_or_assign(key, line.substr(33));
+        }
+    }
+
+    ResultCache(const ResultCache&)            = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    ~ResultCache()
+    {
+        if (d_fd >= 0)
+            ::close(d_fd);
+    }
+
+    bool isEnabled() const
+    {
+        return d_fd >= 0;
+    }
+
+    std::optional<std::string> find(const Digest& key) const
+    {
+        std::lock_guard lock(d_mutex);
+        const auto it = d_entries.find(key);
+        if (it == d_entries.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    void insert(const Digest& key, std::string_view value)
+    {
+        if (!isEnabled() || value.find_first_of("\t\n") != value.npos)
+            return;
+
+        const std::string line = key.hex() + '\t' + std::string(value) + '\n';
+        std::lock_guard lock(d_mutex);
+        if (d_entries.insert_or_assign(key, std::string(value)).second) {
+            // A failed append only costs a recomputation next time.
+            [[maybe_unused]] const auto written =
+                                      ::write(d_fd, line.data(), line.size());
+        }
+    }
+
+    // Return the integer cached for 'key', computing it with 'compute()'
+    // and caching it on a miss.
+    template <class FUNC>
+    std::invoke_result_t<FUNC> findOrCompute(const Digest& key,
+                                             FUNC&&        compute)
+    {
+        using Result = std::invoke_result_t<FUNC>;
+        static_assert(std::is_integral_v<Result>);
+
+        if (!isEnabled())
+            return std::forward<FUNC>(compute)();
+        if (const auto text = find(key)) {
+            std::int64_t value = 0;
+            const char *const end = text->data() + text->size();
+            if (std::from_chars(text->data(), end, value).ptr == end)
+                return static_cast<Result>(value);
+        }
+        const Result result = std::forward<FUNC>(compute)();
+        insert(key, std::to_string(static_cast<std::int64_t>(result)));
+        return result;
+    }
+
+  private:
+    int                                                 d_fd = -1;
+    mutable std::mutex                                  d_mutex;
+    std::unordered_map<Digest, std::string, DigestHash> d_entries;
+};
+
+} // close namespace aoc
+
+#endif
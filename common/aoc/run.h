@@ -0,0 +1,309 @@
+#ifndef INCLUDED_AOC_RUN
+#define INCLUDED_AOC_RUN
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <glob.h>
+
+#include <aoc/checks.h>
+#include <aoc/embedded_input.h>
+#include <aoc/line_reader.h>
+#include <aoc/mapped_file.h>
+#include <aoc/phase.h>
+#include <aoc/result_cache.h>
+#include <aoc/thread_pool.h>
+
+namespace aoc {
+
+// Stream that 'run' prints answers to on this thread; 'std::cout' unless a
+// multi-solution driver has redirected it.
+inline std::ostream *& answerStream()
+{
+    thread_local std::ostream *stream = &std::cout;
+    return stream;
+}
+
+// Name of the alternative implementation that a solution offering several
+// should use, as selected by the 'AOC_MODE' environment variable, e.g.
+//..
+//  $ AOC_MODE=bitplanes ./day_04-ceres_search-part_1
+//..
+// or empty for its default one.  A solution ignores modes it does not have.
+inline std::string_view mode()
+{
+    static const char *const s_mode = std::getenv("AOC_MODE");
+    return s_mode ? s_mode : "";
+}
+
+// Append to 'paths' the input files named by the command-line operand 'arg':
+// the files matching it if it is a glob pattern, the newline-separated paths
+// read from stdin if it is '-', and otherwise 'arg' itself.
+inline void addBatchInputs(std::string_view                    arg,
+                           std::vector<std::filesystem::path>& paths)
+{
+    if (arg == "-") {
+        for (std::string line; std::getline(std::cin, line); ) {
+            if (!line.empty())
+                paths.emplace_back(line);
+        }
+        return;
+    }
+    if (arg.find_first_of("*?[") == std::string_view::npos) {
+        paths.emplace_back(arg);
+        return;
+    }
+    const std::string pattern(arg);
+    glob_t            matches;
+    if (::glob(pattern.c_str(), 0, nullptr, &matches) == 0) {
+        for (std::size_t i = 0; i < matches.gl_pathc; ++i)
+            paths.emplace_back(matches.gl_pathv[i]);
+    }
+    ::globfree(&matches);
+}
+
+// Return the answer of 'solve(input)' as printed.  If 'cache' is enabled and
+// holds the answer for 'key', the digest of the input files 'input' was
+// parsed from, return that instead.
+template <class SOLVE, class INPUT>
+std::string solveCached(SOLVE&                       solve,
+                        INPUT&                       input,
+                        ResultCache&                 cache,
+                        const std::optional<Digest>& key)
+{
+    if (key && cache.isEnabled()) {
+        if (std::optional<std::string> answer = cache.find(*key))
+            return *std::move(answer);
+    }
+    std::ostringstream answer;
+    answer << solve(input);
+    if (key)
+        cache.insert(*key, answer.view());
+    return std::move(answer).str();
+}
+
+// Return 'getInput()', and set 'key' to the digest of the files it mapped if
+// 'cache' is enabled and it mapped any.
+template <class GET_INPUT>
+auto getKeyedInput(GET_INPUT&             getInput,
+                   const ResultCache&     cache,
+                   std::optional<Digest>& key)
+{
+    if (cache.isEnabled())
+        mappedInputDigest().emplace();
+    auto input = getInput();
+    key = std::exchange(mappedInputDigest(), std::nullopt);
+    if (key == Digest{})
+        key.reset();
+    return input;
+}
+
+// Solve every input in 'paths' with 'getInput' and 'solve' on 'numThreads'
+// threads and print one 'PATH<tab>ANSWER' line for each, in the order of
+// 'paths' and as soon as it and all inputs before it are solved.
+template <class GET_INPUT, class SOLVE>
+void runBatch(const std::vector<std::filesystem::path>& paths,
+              std::size_t                               numThreads,
+              GET_INPUT&                                getInput,
+              SOLVE&                                    solve,
+              ResultCache&                              cache)
+{
+    std::vector<std::optional<std::string>> answers(paths.size());
+    std::mutex                              mutex;
+    std::condition_variable                 solved;
+    {
+        ThreadPool pool(numThreads);
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            pool.submit([&, i] {
+                inputFileOverride() = paths[i];
+                std::optional<Digest> key;
+                auto input  = getKeyedInput(getInput, cache, key);
+                auto answer = solveCached(solve, input, cache, key);
+                inputFileOverride().clear();
+                {
+                    std::lock_guard lock(mutex);
+                    answers[i] = std::move(answer);
+                }
+                solved.notify_one();
+            });
+        }
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            std::string answer;
+            {
+                std::unique_lock lock(mutex);
+                solved.wait(lock, [&] { return answers[i].has_value(); });
+                answer = *std::exchange(answers[i], std::nullopt);
+            }
+            *answerStream() << paths[i].string() << '\t' << answer
+                            << std::endl;
+        }
+    }
+}
+
+// Drive one day's solution: time 'getInput()' and 'solve(input)' as separate
+// phases and print the answer.  'solve' receives the parsed input as a
+// mutable lvalue, so solutions that simulate in place need not copy it.
+// First run the checks the day's 'runTests()' registered (see
+// 'runPendingChecks'); if one fails, return 1 without solving.
+//
+// Given command-line operands, solve each of the puzzle inputs they name
+// instead, concurrently, as one "batch" phase:
+//..
+//  $ ./day_NN-name-part_N [-j THREADS] INPUT...
+//  $ find inputs -name '*.txt' | ./day_NN-name-part_N -
+//..
+// An 'INPUT' may be a quoted glob pattern, and '-' reads newline-separated
+// paths from stdin.  The answers are printed as 'PATH<tab>ANSWER' lines in
+// the order the inputs were given.  'THREADS' defaults to the hardware
+// concurrency.  State that a solution caches in function-local statics is
+// built once and shared by all inputs; an input that cannot be read aborts
+// the whole batch.
+//
+// When 'AOC_CACHE_DIR' is set, answers are cached there (see
+// 'ResultCache'), keyed by the content of the input files, in the cache of
+// the solution 'where' identifies at 'version'; then only parsing and
+// hashing are repeated for an input solved before.  Bump 'version' whenever
+// the answers of 'solve' change.
+template <class GET_INPUT, class SOLVE>
+int run(int                  argc,
+        char                *argv[],
+        std::string_view     version,
+        GET_INPUT&&          getInput,
+        SOLVE&&              solve,
+        std::source_location where = std::source_location::current())
+{
+    if (!runPendingChecks())
+        return 1;
+
+    std::vector<std::filesystem::path> paths;
+    bool        batch      = false;
+    std::size_t numThreads = std::thread::hardware_concurrency();
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-j") && (i + 1 < argc)) {
+            numThreads = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg.starts_with('-') && (arg != "-")) {
+            std::cerr << "usage: " << argv[0] << " [-j THREADS] [INPUT...]"
+                      << std::endl;
+            return 2;
+        }
+        else {
+            addBatchInputs(arg, paths);
+            batch = true;
+        }
+    }
+
+    ResultCache cache(std::filesystem::path(where.file_name()).stem().string(),
+                      version);
+    if (batch) {
+        phase("batch", [&] {
+            runBatch(paths, numThreads, getInput, solve, cache);
+            return paths.size();
+        });
+        return 0;
+    }
+    std::optional<Digest> key;
+    auto       input  = phase("getInput", [&] {
+        return getKeyedInput(getInput, cache, key);
+    });
+    const auto answer = phase("solve", [&] {
+        return solveCached(solve, input, cache, key);
+    });
+    *answerStream() << answer << std::endl;
+    return 0;
+}
+
+// Drive a solution that can also fold its input as it reads it, line by
+// line in constant memory: 'stream()' returns the answer for the input it
+// reads through a 'LineReader'.  Run as 'run' does, unless the first
+// operand is '-s':
+//..
+//  $ ./day_NN-name-part_N -s [INPUT...]
+//  $ ./day_NN-name-part_N -s /dev/stdin < huge-input.txt
+//..
+// Then call 'stream()' for the solution's own input and print its answer,
+// or for each 'INPUT' in turn (named as for 'run') and print
+// 'PATH<tab>ANSWER' lines, all as one "stream" phase.  Streaming neither
+// reads nor fills the result cache, which would need a pass over the input
+// first.
+template <class GET_INPUT, class SOLVE, class STREAM>
+int runStreamable(int                  argc,
+                  char                *argv[],
+                  std::string_view     version,
+                  GET_INPUT&&          getInput,
+                  SOLVE&&              solve,
+                  STREAM&&             stream,
+                  std::source_location where = std::source_location::current())
+{
+    if (argc < 2 || std::string_view(argv[1]) != "-s")
+        return run(argc, argv, version, std::forward<GET_INPUT>(getInput),
+                   std::forward<SOLVE>(solve), where);
+    if (!runPendingChecks())
+        return 1;
+
+    std::vector<std::filesystem::path> paths;
+    for (int i = 2; i < argc; ++i)
+        addBatchInputs(argv[i], paths);
+    if (paths.empty()) {
+        const auto answer = phase("stream", [&] { return stream(); });
+        *answerStream() << answer << std::endl;
+        return 0;
+    }
+    phase("stream", [&] {
+        const std::filesystem::path override = inputFileOverride();
+        for (const std::filesystem::path& path : paths) {
+            inputFileOverride() = path;
+            const auto answer   = stream();
+            *answerStream() << path.string() << '\t' << answer << std::endl;
+        }
+        inputFileOverride() = override;
+        return paths.size();
+    });
+    return 0;
+}
+
+// Drive a solution that computes its answer for the 'embeddedInput()' at
+// compile time, 'embeddedAnswer', as 'run' does, except that when there is
+// an embedded input and no other input is named (by operands or this
+// thread's 'inputFileOverride()') 'embeddedAnswer' is printed without
+// calling 'getInput' or 'solve'.  Their phases are still reported, so that
+// timings compare with those of 'run'.
+template <class ANSWER, class GET_INPUT, class SOLVE>
+int runEmbedded(int                  argc,
+                char                *argv[],
+                std::string_view     version,
+                const ANSWER&        embeddedAnswer,
+                GET_INPUT&&          getInput,
+                SOLVE&&              solve,
+                std::source_location where = std::source_location::current())
+{
+    if (!runPendingChecks())
+        return 1;
+    if (embeddedInput().empty() || argc > 1 || !inputFileOverride().empty())
+        return run(argc, argv, version, std::forward<GET_INPUT>(getInput),
+                   std::forward<SOLVE>(solve), where);
+
+    phase("getInput", [] { return 0; });
+    const auto answer = phase("solve", [&] { return embeddedAnswer; });
+    *answerStream() << answer << std::endl;
+    return 0;
+}
+
+} // close namespace aoc
+
+#endif
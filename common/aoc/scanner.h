@@ -0,0 +1,185 @@
+#ifndef INCLUDED_AOC_SCANNER
+#define INCLUDED_AOC_SCANNER
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace aoc {
+
+// Allocation-free cursor over a 'std::string_view' for parsing puzzle inputs
+// without 'std::regex' or streams.  Every 'consume*'/'read*' either matches
+// at the cursor and advances past the match, or fails and leaves the cursor
+// where it was, so alternatives can be tried in turn.  A 'Scanner' is a pair
+// of pointers: copy it to look ahead and assign the copy back to commit.
+class Scanner {
+  public:
+    explicit Scanner(std::string_view text)
+        : d_pos(text.data())
+        , d_end(text.data() + text.size())
+    {
+    }
+
+    bool atEnd() const
+    {
+        return d_pos == d_end;
+    }
+
+    std::string_view rest() const
+    {
+        return { d_pos, static_cast<std::size_t>(d_end - d_pos) };
+    }
+
+    // Advance by 'n' characters, or to the end if fewer remain.
+    void advance(std::size_t n = 1)
+    {
+        d_pos += std::min<std::size_t>(n, d_end - d_pos);
+    }
+
+    bool consume(char c)
+    {
+        if (d_pos == d_end || *d_pos != c)
+            return false;
+        ++d_pos;
+        return true;
+    }
+
+    bool consume(std::string_view literal)
+    {
+        if (!rest().starts_with(literal))
+            return false;
+        d_pos += literal.size();
+        return true;
+    }
+
+    // Consume the rest of the current line and its '\n', if any.
+    void skipLine()
+    {
+        if (skipTo('\n'))
+            ++d_pos;
+    }
+
+    // Move the cursor to the next 'c', or to the end if there is none, and
+    // return whether 'c' was found.
+    bool skipTo(char c)
+    {
+        const void *found = std::memchr(d_pos, c, d_end - d_pos);
+        d_pos = found ? static_cast<const char *>(found) : d_end;
+        return found;
+    }
+
+    // Move the cursor to the next character that is in 'set', or to the end
+    // if there is none, and return whether one was found.
+    bool skipToAny(std::string_view set)
+    {
+#ifdef __SSE2__
+        if (set.size() <= 4) {
+            __m128i needles[4];
+            for (std::size_t i = 0; i < set.size(); ++i)
+                needles[i] = _mm_set1_epi8(set[i]);
+            for ( ; d_end - d_pos >= 16; d_pos += 16) {
+                const auto *const chunk =
+                                     reinterpret_cast<const __m128i *>(d_pos);
+                const __m128i block = _mm_loadu_si128(chunk);
+                __m128i hits = _mm_setzero_si128();
+                for (std::size_t i = 0; i < set.size(); ++i)
+                    hits = _mm_or_si128(hits,
+                                        _mm_cmpeq_epi8(block, needles[i]));
+                if (const int mask = _mm_movemask_epi8(hits)) {
+                    d_pos += __builtin_ctz(mask);
+                    return true;
+                }
+            }
+        }
+#endif
+        while (d_pos != d_end && set.find(*d_pos) == set.npos)
+            ++d_pos;
+        return d_pos != d_end;
+    }
+
+    // Read an optionally signed (for signed 'INT') decimal integer of at most
+    // 'maxDigits' digits into 'value'.  Fail if there is no digit or the
+    // number continues past 'maxDigits'.
+    template <class INT>
+    bool readInt(INT& value,
+                 int  maxDigits = std::numeric_limits<INT>::digits10 + 1)
+    {
+        const char *p = d_pos;
+        bool negative = false;
+        if constexpr (std::is_signed_v<INT>) {
+            if (p != d_end && (*p == '-' || *p == '+'))
+                negative = (*p++ == '-');
+        }
+        INT result = 0;
+        const char *const digits = p;
+#ifdef __SSE2__
+        if constexpr (std::numeric_limits<INT>::digits10 >= 8) {
+            if (d_end - p >= 16) {
+                const int numDigits = countDigits(p);
+                if (numDigits == 0 || numDigits > maxDigits)
+                    return false;
+                if (numDigits <= 8) {
+                    value = negative ? -INT(parse8Digits(p, numDigits))
+                                     :  INT(parse8Digits(p, numDigits));
+                    d_pos = p + numDigits;
+                    return true;
+                }
+            }
+        }
+#endif
+        while (p != d_end && isDigit(*p) && p - digits < maxDigits)
+            result = result * 10 + (*p++ - '0');
+        if (p == digits || (p != d_end && isDigit(*p)))
+            return false;
+
+        value = negative ? -result : result;
+        d_pos = p;
+        return true;
+    }
+
+  private:
+    static bool isDigit(char c)
+    {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+#ifdef __SSE2__
+    // Return the number of decimal digits that 'p' starts with, up to 16;
+    // 16 bytes must be readable there.
+    static int countDigits(const char *p)
+    {
+        const __m128i block  = _mm_loadu_si128(
+                                         reinterpret_cast<const __m128i *>(p));
+        const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8('0' - 128));
+        const __m128i digits = _mm_cmplt_epi8(offset, _mm_set1_epi8(-128 + 10));
+        return __builtin_ctz(~_mm_movemask_epi8(digits));
+    }
+
+    // Return the value of the 'numDigits' (1 to 8) digits at 'p', converted
+    // all at once in one 64-bit word; 8 bytes must be readable there.
+    static std::uint32_t parse8Digits(const char *p, int numDigits)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof word);
+        word <<= 8 * (8 - numDigits);  // leading zeros, little-endian
+        word = (word & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+        word = (word & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+        return (word & 0x0000FFFF0000FFFF) * 42949672960001 >> 32;
+    }
+#endif
+
+    const char *d_pos;
+    const char *d_end;
+};
+
+} // close namespace aoc
+
+#endif
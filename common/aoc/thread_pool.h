@@ -0,0 +1,231 @@
+#ifndef INCLUDED_AOC_THREAD_POOL
+#define INCLUDED_AOC_THREAD_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Fixed set of worker threads, each with its own job deque.  A worker runs
+// jobs from the front of its own deque and, once that is empty, steals from
+// the front of the others'.  Jobs submitted from outside the pool are dealt
+// round-robin, so submitting them in decreasing order of expected cost keeps
+// every deque longest-job-first.  Jobs submitted by a running job go to the
+// front of its worker's deque.
+class ThreadPool {
+  public:
+    using Job = std::function<void()>;
+
+    explicit ThreadPool(
+                   std::size_t numThreads = std::thread::hardware_concurrency())
+    {
+        numThreads = std::max<std::size_t>(numThreads, 1);
+        for (std::size_t i = 0; i < numThreads; ++i)
+            d_queues.push_back(std::make_unique<Queue>());
+        for (std::size_t i = 0; i < numThreads; ++i)
+            d_threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Finish every submitted job, then join the workers.
+    ~ThreadPool()
+    {
+        wait();
+        {
+            std::lock_guard lock(d_mutex);
+            d_stopping = true;
+        }
+        d_wakeup.notify_all();
+        for (auto& thread : d_threads)
+            thread.join();
+    }
+
+    std::size_t size() const
+    {
+        return d_threads.size();
+    }
+
+    // Whether the calling thread is one of this pool's workers.
+    bool isWorkerThread() const
+    {
+        return workerIndex().first == this;
+    }
+
+    void submit(Job job)
+    {
+        if (workerIndex().first == this) {
+            Queue& queue = *d_queues[workerIndex().second];
+            std::lock_guard lock(queue.d_mutex);
+            queue.d_jobs.push_front(std::move(job));
+        }
+        else {
+            Queue& queue = *d_queues[d_nextQueue++ % d_queues.size()];
+            std::lock_guard lock(queue.d_mutex);
+            queue.d_jobs.push_back(std::move(job));
+        }
+        {
+            std::lock_guard lock(d_mutex);
+            ++d_numQueued;
+            ++d_numPending;
+        }
+        d_wakeup.notify_one();
+    }
+
+    // Block until every job submitted so far has finished.  Must not be
+    // called from one of this pool's jobs.
+    void wait()
+    {
+        std::unique_lock lock(d_mutex);
+        d_idle.wait(lock, [this] { return d_numPending == 0; });
+    }
+
+  private:
+    struct Queue {
+        std::mutex      d_mutex;
+        std::deque<Job> d_jobs;
+    };
+
+    // The pool that the calling thread works for, if any, and its index there.
+    static std::pair<const ThreadPool *, std::size_t>& workerIndex()
+    {
+        thread_local std::pair<const ThreadPool *, std::size_t> index{};
+        return index;
+    }
+
+    bool tryPop(std::size_t self, Job& job)
+    {
+        for (std::size_t i = 0; i < d_queues.size(); ++i) {
+            Queue& queue = *d_queues[(self + i) % d_queues.size()];
+            std::lock_guard lock(queue.d_mutex);
+            if (!queue.d_jobs.empty()) {
+                job = std::move(queue.d_jobs.front());
+                queue.d_jobs.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(std::size_t self)
+    {
+        workerIndex() = { this, self };
+        for (;;) {
+            {
+                std::unique_lock lock(d_mutex);
+                d_wakeup.wait(lock, [this] {
+                    return d_stopping || d_numQueued > 0;
+                });
+                if (d_numQueued == 0)
+                    return;
+                --d_numQueued;
+            }
+
+            // Having claimed one of the queued jobs, some deque is guaranteed
+            // to hold a job for us.
+            Job job;
+            while (!tryPop(self, job)) {
+            }
+            job();
+
+            std::lock_guard lock(d_mutex);
+            if (--d_numPending == 0)
+                d_idle.notify_all();
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> d_queues;
+    std::vector<std::thread>            d_threads;
+    std::atomic<std::size_t>            d_nextQueue = 0;
+    std::mutex                          d_mutex;
+    std::condition_variable             d_wakeup, d_idle;
+    std::size_t                         d_numQueued  = 0;
+    std::size_t                         d_numPending = 0;
+    bool                                d_stopping   = false;
+};
+
+// Pool shared by the solutions that split up their own work, with
+// '$AOC_THREADS' workers if that is set (e.g. to measure how a solution
+// scales), and otherwise one per hardware thread.
+inline ThreadPool& sharedThreadPool()
+{
+    static ThreadPool s_pool([] {
+        const char *const numThreads = std::getenv("AOC_THREADS");
+        return numThreads && std::atoi(numThreads) > 0
+             ? std::size_t(std::atoi(numThreads))
+             : std::size_t(std::thread::hardware_concurrency());
+    }());
+    return s_pool;
+}
+
+// Call 'body(i)' for every 'i' in '[0, count)' as jobs of
+// 'sharedThreadPool()', and return once all the calls have returned.  They
+// run inline instead, in order, if there is just one or if the caller is
+// itself one of the pool's workers (which must not block on the others).
+template <class BODY>
+void parallelFor(std::size_t count, BODY&& body)
+{
+    ThreadPool& pool = sharedThreadPool();
+    if (count <= 1 || pool.isWorkerThread()) {
+        for (std::size_t i = 0; i < count; ++i)
+            body(i);
+        return;
+    }
+    std::latch done(static_cast<std::ptrdiff_t>(count));
+    for (std::size_t i = 0; i < count; ++i) {
+        pool.submit([&, i] {
+            body(i);
+            done.count_down();
+        });
+    }
+    done.wait();
+}
+
+// Split '[0, count)' into consecutive ranges of at least 'minChunkSize'
+// elements, and at most four per worker of 'sharedThreadPool()' so that idle
+// workers have some to steal.  Call 'map(begin, end)' for each range as with
+// 'parallelFor', and return 'init' folded with the results left to right by
+// 'reduce(accumulated, result)'.  With a single range, 'map' runs inline and
+// the pool is not even started.
+template <class T, class MAP, class REDUCE = std::plus<>>
+T parallelReduce(std::size_t count,
+                 std::size_t minChunkSize,
+                 T           init,
+                 MAP&&       map,
+                 REDUCE&&    reduce = {})
+{
+    using Result = std::invoke_result_t<MAP&, std::size_t, std::size_t>;
+
+    const std::size_t numRanges = count /
+                                  std::max<std::size_t>(minChunkSize, 1);
+    if (numRanges <= 1)
+        return reduce(std::move(init), map(std::size_t(0), count));
+
+    const std::size_t numChunks = std::min(numRanges,
+                                           4 * sharedThreadPool().size());
+    std::vector<Result> results(numChunks);
+    parallelFor(numChunks, [&](std::size_t i) {
+        results[i] = map(count *  i      / numChunks,
+                         count * (i + 1) / numChunks);
+    });
+    for (Result& result : results)
+        init = reduce(std::move(init), std::move(result));
+    return init;
+}
+
+} // close namespace aoc
+
+#endif
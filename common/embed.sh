@@ -0,0 +1,12 @@
+#!/bin/sh
+# Usage: embed.sh INPUT
+#
+# Print a header that embeds the puzzle input file INPUT in a binary built with
+# '-DAOC_EMBEDDED_INPUT=<header>' (see <aoc/embedded_input.h>).  Only the file
+# name of INPUT is recorded, as that is what the solution asks for.
+
+echo "// Generated from $(basename "$1") by embed.sh -- do not edit."
+echo "#define AOC_EMBEDDED_INPUT_NAME \"$(basename "$1")\""
+echo '#define AOC_EMBEDDED_INPUT_BYTES \'
+od -An -v -tx1 "$1" | sed -e "s/ \([0-9a-f][0-9a-f]\)/'\\\\x\1',/g" -e 's/$/ \\/'
+echo
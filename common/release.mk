@@ -0,0 +1,71 @@
+# Optimized, sanitizer-free build of every solution in the including
+# directory.  Each 'day_NN-*-part_N.cpp' yields 'day_NN-*-part_N-release' next
+# to the regular debug binary.  Included at the bottom of each day's Makefile.
+#
+# Optional, and combinable, on the command line (also from the top level):
+#..
+#  make release LTO=1   # link-time optimization
+#  make release PGO=1   # train on the day's real input, then rebuild
+#  make release ALLOC_STATS=1   # count heap allocations per phase
+#..
+# A PGO build first runs an instrumented binary in this directory, so the
+# puzzle input must be present.  Runs that do not finish within
+# 'PGO_TIMEOUT' seconds leave no profile and the binary is built untrained.
+# With 'ALLOC_STATS=1' every phase in the 'AOC_PHASE_LOG' also reports its
+# allocation count, bytes and peak heap size (see <aoc/alloc_stats.h>).  The
+# flags are not tracked as a dependency, so 'make clean-release' when
+# switching.
+#
+# 'make embed' (combinable with 'LTO=1' and 'ALLOC_STATS=1') instead yields
+# 'day_NN-*-part_N-embed' binaries with the day's puzzle input compiled in
+# (see <aoc/embedded_input.h>): they open no input file, and solutions that
+# parse their input in constant expressions answer it without solving at run
+# time.  Other inputs are still read from files, e.g. when given as operands.
+
+RELEASE_BINS=$(SRCS:%.cpp=%-release)
+EMBED_BINS=$(SRCS:%.cpp=%-embed)
+EMBED_HEADER=embedded_input.gen.h
+RELEASE_CXXFLAGS=-std=c++23 -O3 -march=native -DNDEBUG -Wall -I../../common
+RELEASE_LDFLAGS=
+PGO_TIMEOUT=120
+
+ifeq ($(LTO),1)
+RELEASE_CXXFLAGS+=-flto=auto
+endif
+ifeq ($(ALLOC_STATS),1)
+RELEASE_CXXFLAGS+=-DAOC_ALLOC_STATS
+endif
+
+.PHONY: release embed clean-release
+
+release: $(RELEASE_BINS)
+
+embed: $(EMBED_BINS)
+
+# $(call pgo-train,SOURCE,BINARY): build an instrumented 'BINARY' and run it
+# once to populate 'BINARY.profile'.
+pgo-train = $(RM) -r $2.profile && \
+	g++ $1 $(RELEASE_CXXFLAGS) -fprofile-generate=$2.profile \
+	    $(RELEASE_LDFLAGS) -o $2 && \
+	{ timeout $(PGO_TIMEOUT) ./$2 >/dev/null || true; }
+
+PGO_USE_FLAGS=-fprofile-use=$@.profile -fprofile-partial-training \
+              -Wno-missing-profile
+
+%-release: %.cpp
+	$(if $(filter 1,$(PGO)),$(call pgo-train,$<,$@))
+	g++ $< $(RELEASE_CXXFLAGS) $(if $(filter 1,$(PGO)),$(PGO_USE_FLAGS)) \
+	    $(RELEASE_LDFLAGS) -o $@
+
+$(EMBED_HEADER): $(wildcard *-input.txt) ../../common/embed.sh
+	../../common/embed.sh $< > $@
+
+%-embed: %.cpp $(EMBED_HEADER)
+	g++ $< $(RELEASE_CXXFLAGS) -DAOC_EMBEDDED_INPUT='"$(EMBED_HEADER)"' \
+	    -iquote . $(RELEASE_LDFLAGS) -o $@
+
+clean: clean-release
+
+clean-release:
+	$(RM) $(RELEASE_BINS) $(EMBED_BINS) $(EMBED_HEADER)
+	$(RM) -r $(RELEASE_BINS:%=%.profile)
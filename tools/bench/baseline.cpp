@@ -0,0 +1,490 @@
+// Keep per-solution timing baselines and check new 'bench' tables against
+// them, to catch slowdowns:
+//..
+//  $ bench BINARY... > table.tsv
+//  $ baseline save    [-d DIR] [TABLE]
+//  $ baseline compare [-d DIR] [-t PERCENT] [-p PHASE] [-f] [TABLE]
+//  solution  year  day  part  phase  baseline_ns  median_ns  change_pct
+//  instructions_change_pct  status
+//..
+// 'save' stores each solution of the 'bench' table 'TABLE' (stdin by default)
+// as 'DIR/YEAR-DD-part_N.json' ('DIR' is 'baselines' by default), replacing
+// any earlier baseline: every figure the table has for each of its phases
+// (median time, hardware counts, peak memory, ...) and the machine it was
+// measured on.  'compare' reports, for each solution in 'TABLE' and its phase
+// 'PHASE' ("solve" by default), how its median time changed against its
+// baseline.  The status is 'SLOWER' when it grew by more than 'PERCENT' (10
+// by default), and the exit status is then 1.  Baselines from another machine
+// (host name, CPU model and count) are not compared but reported as
+// 'other-machine', unless '-f' forces it; solutions without one are 'new'.
+// Everything stays on the local file system.
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+// One row of a 'bench' table: its columns by name, without the '-' ones.
+using Row = std::map<std::string, std::string, std::less<>>;
+
+// Read the 'bench' table from 'stream'.
+std::vector<Row> readTable(std::istream& stream)
+{
+    std::vector<Row>         rows;
+    std::vector<std::string> columns;
+    for (std::string line; std::getline(stream, line); ) {
+        std::vector<std::string> fields;
+        std::istringstream       fieldStream(line);
+        for (std::string field; std::getline(fieldStream, field, '\t'); )
+            fields.push_back(std::move(field));
+        if (columns.empty()) {
+            columns = std::move(fields);
+            continue;
+        }
+        Row& row = rows.emplace_back();
+        for (std::size_t i = 0; i < fields.size() && i < columns.size(); ++i) {
+            if (fields[i] != "-")
+                row[columns[i]] = std::move(fields[i]);
+        }
+    }
+    return rows;
+}
+
+// Return the integer in 'row' under 'column', or nothing.
+std::optional<std::int64_t> intField(const Row& row, std::string_view column)
+{
+    const auto it = row.find(column);
+    if (it == row.end())
+        return std::nullopt;
+    std::int64_t value = 0;
+    const char *const end = it->second.data() + it->second.size();
+    if (std::from_chars(it->second.data(), end, value).ptr != end)
+        return std::nullopt;
+    return value;
+}
+
+// Describe this machine well enough that timings taken on another one are
+// not compared with its own: host name, CPU model and CPU count.
+std::string machineId()
+{
+    char host[256] = {};
+    ::gethostname(host, sizeof host - 1);
+
+    std::string   model = "unknown CPU";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    for (std::string line; std::getline(cpuinfo, line); ) {
+        if (line.starts_with("model name")) {
+            model = line.substr(line.find(':') + 2);
+            break;
+        }
+    }
+    return std::string(host) + " / " + model + " / " +
+           std::to_string(std::thread::hardware_concurrency()) + " CPUs";
+}
+
+// Minimal JSON support for baseline files: 'JsonWriter' emits objects whose
+// values are strings, integers or further objects, and 'readJson' reads any
+// such document back as a map from each value's dotted path (e.g.
+// "phases.solve.median_ns") to its text.
+using FlatJson = std::map<std::string, std::string, std::less<>>;
+
+std::string quoteJson(std::string_view text)
+{
+    std::string quoted = "\"";
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            char escape[8];
+            std::snprintf(escape, sizeof escape, "\\u%04x", c);
+            quoted += escape;
+        }
+        else {
+            quoted += c;
+        }
+    }
+    return quoted + '"';
+}
+
+class JsonWriter {
+  public:
+    explicit JsonWriter(std::ostream& stream)
+        : d_stream(stream)
+    {
+        d_stream << '{';
+    }
+
+    void add(std::string_view key, std::string_view value)
+    {
+        startMember(key);
+        d_stream << quoteJson(value);
+    }
+
+    void add(std::string_view key, std::int64_t value)
+    {
+        startMember(key);
+        d_stream << value;
+    }
+
+    void openObject(std::string_view key)
+    {
+        startMember(key);
+        d_stream << '{';
+        d_isFirst.push_back(true);
+    }
+
+    void closeObject()
+    {
+        d_isFirst.pop_back();
+        d_stream << '\n' << std::string(2 * d_isFirst.size(), ' ') << '}';
+    }
+
+    // Close the document.
+    void finish()
+    {
+        closeObject();
+        d_stream << '\n';
+    }
+
+  private:
+    void startMember(std::string_view key)
+    {
+        if (!d_isFirst.back())
+            d_stream << ',';
+        d_isFirst.back() = false;
+        d_stream << '\n' << std::string(2 * d_isFirst.size(), ' ')
+                 << quoteJson(key) << ": ";
+    }
+
+    std::ostream&     d_stream;
+    std::vector<bool> d_isFirst = { true };
+};
+
+class JsonReader {
+  public:
+    explicit JsonReader(std::string_view text)
+        : d_text(text)
+    {
+    }
+
+    // Read the document into 'values', returning false if it is malformed.
+    bool read(FlatJson& values)
+    {
+        return readValue("", values) && (skipSpace(), d_pos == d_text.size());
+    }
+
+  private:
+    void skipSpace()
+    {
+        while (d_pos < d_text.size() &&
+               std::string_view(" \t\r\n").find(d_text[d_pos]) !=
+                                                         std::string_view::npos)
+            ++d_pos;
+    }
+
+    bool consume(char c)
+    {
+        skipSpace();
+        if (d_pos < d_text.size() && d_text[d_pos] == c) {
+            ++d_pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool readString(std::string& text)
+    {
+        if (!consume('"'))
+            return false;
+        for (text.clear(); d_pos < d_text.size(); ++d_pos) {
+            char c = d_text[d_pos];
+            if (c == '"') {
+                ++d_pos;
+                return true;
+            }
+            if (c == '\\') {
+                if (++d_pos == d_text.size())
+                    return false;
+                c = d_text[d_pos];
+                if (c == 'u') {
+                    unsigned code = 0;
+                    if (d_pos + 4 >= d_text.size() ||
+                        std::from_chars(&d_text[d_pos + 1], &d_text[d_pos + 5],
+                                        code, 16).ptr != &d_text[d_pos + 5])
+                        return false;
+                    c = static_cast<char>(code);  // only ever ASCII here
+                    d_pos += 4;
+                }
+                else if (c == 'n') {
+                    c = '\n';
+                }
+                else if (c == 't') {
+                    c = '\t';
+                }
+            }
+            text += c;
+        }
+        return false;
+    }
+
+    bool readValue(const std::string& path, FlatJson& values)
+    {
+        skipSpace();
+        if (d_pos == d_text.size())
+            return false;
+        if (d_text[d_pos] == '{') {
+            ++d_pos;
+            if (consume('}'))
+                return true;
+            do {
+                std::string key;
+                if (!readString(key) || !consume(':') ||
+                    !readValue(path.empty() ? key : path + '.' + key, values))
+                    return false;
+            } while (consume(','));
+            return consume('}');
+        }
+        if (d_text[d_pos] == '"')
+            return readString(values[path]);
+
+        const std::size_t start = d_pos;
+        while (d_pos < d_text.size() &&
+               std::string_view(",}] \t\r\n").find(d_text[d_pos]) ==
+                                                         std::string_view::npos)
+            ++d_pos;
+        values[path] = d_text.substr(start, d_pos - start);
+        return d_pos > start;
+    }
+
+    std::string_view d_text;
+    std::size_t      d_pos = 0;
+};
+
+std::filesystem::path baselinePath(const std::filesystem::path& directory,
+                                   const Row&                   row)
+{
+    char name[64];
+    std::snprintf(name, sizeof name, "%s-%02d-part_%s.json",
+                  row.at("year").c_str(), std::atoi(row.at("day").c_str()),
+                  row.at("part").c_str());
+    return directory / name;
+}
+
+// Return the baseline at 'path', or nothing if it is missing or malformed.
+std::optional<FlatJson> readBaseline(const std::filesystem::path& path)
+{
+    std::ifstream stream(path);
+    if (!stream)
+        return std::nullopt;
+    const std::string text(std::istreambuf_iterator<char>(stream), {});
+    FlatJson values;
+    if (!JsonReader(text).read(values)) {
+        std::cerr << path.string() << ": malformed baseline" << std::endl;
+        return std::nullopt;
+    }
+    return values;
+}
+
+// Bench table columns that are not measurements of the phase.
+bool isKeyColumn(std::string_view column)
+{
+    return column == "solution" || column == "year" || column == "day" ||
+           column == "part"     || column == "phase";
+}
+
+int save(const std::vector<Row>& rows, const std::filesystem::path& directory)
+{
+    // Group the phase rows by solution, keeping the table's order.
+    std::vector<std::vector<const Row *>> solutions;
+    for (const Row& row : rows) {
+        if (!row.contains("solution") || !row.contains("phase"))
+            continue;
+        if (solutions.empty() ||
+            solutions.back().front()->at("solution") != row.at("solution"))
+            solutions.emplace_back();
+        solutions.back().push_back(&row);
+    }
+
+    std::filesystem::create_directories(directory);
+    const std::string machine  = machineId();
+    char              recorded[32];
+    const std::time_t now      = std::time(nullptr);
+    std::strftime(recorded, sizeof recorded, "%Y-%m-%dT%H:%M:%SZ",
+                  std::gmtime(&now));
+    for (const auto& phases : solutions) {
+        const Row&                  first = *phases.front();
+        const std::filesystem::path path  = baselinePath(directory, first);
+        std::ofstream               stream(path);
+        JsonWriter                  json(stream);
+        json.add("solution", first.at("solution"));
+        json.add("year", *intField(first, "year"));
+        json.add("day",  *intField(first, "day"));
+        json.add("part", *intField(first, "part"));
+        json.add("machine", machine);
+        json.add("recorded", recorded);
+        json.openObject("phases");
+        for (const Row *row : phases) {
+            json.openObject(row->at("phase"));
+            for (const auto& [column, value] : *row) {
+                if (const auto number = intField(*row, column);
+                    number && !isKeyColumn(column))
+                    json.add(column, *number);
+            }
+            json.closeObject();
+        }
+        json.closeObject();
+        json.finish();
+        if (!stream) {
+            std::cerr << "Failed to write " << path.string() << std::endl;
+            return 1;
+        }
+        std::cerr << "saved " << path.string() << std::endl;
+    }
+    return 0;
+}
+
+// Return the change from 'before' to 'after' in percent of 'before'.
+double changePercent(std::int64_t before, std::int64_t after)
+{
+    return before > 0 ? 100.0 * double(after - before) / double(before) : 0.0;
+}
+
+int compare(const std::vector<Row>&      rows,
+            const std::filesystem::path& directory,
+            std::string_view             phase,
+            double                       thresholdPercent,
+            bool                         force)
+{
+    const std::string machine = machineId();
+    int               status  = 0;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "solution\tyear\tday\tpart\tphase\tbaseline_ns\tmedian_ns"
+                 "\tchange_pct\tinstructions_change_pct\tstatus" << std::endl;
+    for (const Row& row : rows) {
+        if (!row.contains("solution") || !row.contains("phase") ||
+            row.at("phase") != phase)
+            continue;
+
+        std::cout << row.at("solution") << '\t' << row.at("year") << '\t'
+                  << row.at("day") << '\t' << row.at("part") << '\t'
+                  << phase << '\t';
+        const std::optional<std::int64_t> medianNs = intField(row,
+                                                              "median_ns");
+        const std::optional<FlatJson> baseline = readBaseline(
+                                               baselinePath(directory, row));
+        const std::string prefix = "phases." + std::string(phase) + '.';
+        const auto baselineField = [&](std::string_view key)
+                                                -> std::optional<std::int64_t> {
+            if (!baseline)
+                return std::nullopt;
+            const auto it = baseline->find(prefix + std::string(key));
+            std::int64_t value = 0;
+            if (it == baseline->end() ||
+                std::from_chars(it->second.data(),
+                                it->second.data() + it->second.size(),
+                                value).ec != std::errc())
+                return std::nullopt;
+            return value;
+        };
+        const std::optional<std::int64_t> baselineNs =
+                                                    baselineField("median_ns");
+        if (!baselineNs || !medianNs) {
+            std::cout << "-\t" << (medianNs ? *medianNs : 0) << "\t-\t-\tnew"
+                      << std::endl;
+            continue;
+        }
+
+        const double change = changePercent(*baselineNs, *medianNs);
+        std::cout << *baselineNs << '\t' << *medianNs << '\t' << change
+                  << '\t';
+        const auto instructions         = intField(row, "instructions");
+        const auto baselineInstructions = baselineField("instructions");
+        if (instructions && baselineInstructions)
+            std::cout << changePercent(*baselineInstructions, *instructions);
+        else
+            std::cout << '-';
+
+        const auto it = baseline->find("machine");
+        if (!force && (it == baseline->end() || it->second != machine)) {
+            std::cout << "\tother-machine" << std::endl;
+        }
+        else if (change > thresholdPercent) {
+            std::cout << "\tSLOWER" << std::endl;
+            status = 1;
+        }
+        else {
+            std::cout << "\tok" << std::endl;
+        }
+    }
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    const std::string_view command = argc > 1 ? argv[1] : "";
+    std::filesystem::path  directory = "baselines";
+    std::string_view       phase     = "solve";
+    double                 threshold = 10;
+    bool                   force     = false;
+    std::string_view       tablePath;
+    bool                   usage = command != "save" && command != "compare";
+    for (int i = 2; i < argc && !usage; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-d") && (i + 1 < argc)) {
+            directory = argv[++i];
+        }
+        else if ((arg == "-t") && (i + 1 < argc) && command == "compare") {
+            threshold = std::atof(argv[++i]);
+        }
+        else if ((arg == "-p") && (i + 1 < argc) && command == "compare") {
+            phase = argv[++i];
+        }
+        else if ((arg == "-f") && command == "compare") {
+            force = true;
+        }
+        else if (arg.starts_with('-') || !tablePath.empty()) {
+            usage = true;
+        }
+        else {
+            tablePath = arg;
+        }
+    }
+    if (usage) {
+        std::cerr << "usage: " << argv[0] << " save [-d DIR] [TABLE]\n"
+                  << "       " << argv[0] << " compare [-d DIR] [-t PERCENT]"
+                     " [-p PHASE] [-f] [TABLE]" << std::endl;
+        return 2;
+    }
+
+    std::ifstream tableFile;
+    if (!tablePath.empty()) {
+        tableFile.open(std::string(tablePath));
+        if (!tableFile) {
+            std::cerr << "Failed to open " << tablePath << std::endl;
+            return 2;
+        }
+    }
+    const std::vector<Row> rows = readTable(tablePath.empty() ? std::cin
+                                                              : tableFile);
+    return command == "save" ? save(rows, directory)
+                             : compare(rows, directory, phase, threshold,
+                                       force);
+}
@@ -0,0 +1,248 @@
+// Run every given solution binary repeatedly against its own puzzle input and
+// report per-phase wall-time statistics as a tab-separated table:
+//..
+//  $ bench [-n RUNS] BINARY...
+//  solution    year  day  part  phase     runs  min_ns  median_ns  p99_ns
+//  cycles  instructions  cache_misses  branch_misses
+//  allocs  alloc_bytes  peak_heap_bytes  peak_rss_bytes
+//..
+// Each binary is started in its own directory (where its input lives) with
+// 'AOC_PHASE_LOG' pointing at a scratch file, into which 'aoc::run' appends one
+// line per phase.  Binaries that report no phases (e.g. the interactive
+// visualizations) are listed on stderr and skipped.  The hardware counter
+// columns hold the median over the runs and the memory columns the largest
+// value; either is '-' where the binary reports nothing (the counters need
+// 'perf_event_open' to work, the heap figures 'make release ALLOC_STATS=1').
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Keys of the optional figures of a phase line, in column order.
+const std::array<std::string_view, 4> k_CounterKeys = {
+    "cycles", "instructions", "cache_misses", "branch_misses"
+};
+const std::array<std::string_view, 4> k_MemoryKeys = {
+    "allocs", "alloc_bytes", "peak_heap_bytes", "peak_rss_bytes"
+};
+
+struct Solution {
+    std::filesystem::path d_binary;
+    std::string           d_name;
+    int                   d_year = 0, d_day = 0, d_part = 0;
+};
+
+// Recover the calendar coordinates from a path such as
+// '2024/22/day_22-monkey_market-part_2-release'.
+Solution makeSolution(const std::filesystem::path& binary)
+{
+    Solution solution{ std::filesystem::absolute(binary) };
+    std::string name = binary.filename().string();
+    if (name.ends_with("-release"))
+        name.resize(name.size() - std::string_view("-release").size());
+
+    solution.d_name = name;
+    const auto parseInt = [](std::string_view str, int& value) {
+        std::from_chars(str.data(), str.data() + str.size(), value);
+    };
+    parseInt(binary.parent_path().parent_path().filename().string(),
+             solution.d_year);
+    if (name.starts_with("day_"))
+        parseInt(std::string_view(name).substr(4, 2), solution.d_day);
+    if (const auto p = name.rfind("-part_"); p != std::string::npos)
+        parseInt(std::string_view(name).substr(p + 6), solution.d_part);
+    return solution;
+}
+
+// Run 'solution' once with its output discarded and append each reported
+// phase's line (without the trailing newline) to 'phaseLines'.  Return the
+// wait status.
+int runOnce(const Solution& solution, std::vector<std::string>& phaseLines)
+{
+    char logPath[] = "/tmp/aoc-bench-XXXXXX";
+    const int logFd = ::mkstemp(logPath);
+    if (logFd < 0) {
+        std::perror("mkstemp");
+        std::exit(1);
+    }
+    ::close(logFd);
+
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        const int devNull = ::open("/dev/null", O_WRONLY);
+        ::dup2(devNull, STDOUT_FILENO);
+        ::dup2(devNull, STDERR_FILENO);
+        ::setenv("AOC_PHASE_LOG", logPath, 1);
+        if (::chdir(solution.d_binary.parent_path().c_str()) != 0)
+            ::_exit(127);
+
+        const std::string binary = solution.d_binary.string();
+        ::execl(binary.c_str(), binary.c_str(), static_cast<char *>(nullptr));
+        ::_exit(127);
+    }
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+
+    std::ifstream log(logPath);
+    for (std::string line; std::getline(log, line); )
+        phaseLines.push_back(std::move(line));
+    ::unlink(logPath);
+    return status;
+}
+
+// Return the value of 'key' among the tab-separated 'key=value' fields of the
+// phase 'line', or -1 if there is none.
+std::int64_t fieldValue(std::string_view line, std::string_view key)
+{
+    for (auto tab = line.find('\t'); tab != std::string_view::npos;
+                                       tab = line.find('\t', tab + 1)) {
+        const std::string_view field = line.substr(tab + 1);
+        if (field.starts_with(key) && field.substr(key.size()).starts_with('=')) {
+            std::int64_t value = -1;
+            std::from_chars(field.data() + key.size() + 1,
+                            field.data() + field.size(), value);
+            return value;
+        }
+    }
+    return -1;
+}
+
+// Nearest-rank percentile of the already sorted 'samples'.
+std::int64_t percentile(const std::vector<std::int64_t>& samples, double q)
+{
+    assert(!samples.empty());
+
+    const auto rank = static_cast<std::size_t>(std::ceil(q * samples.size()));
+    return samples[std::clamp<std::size_t>(rank, 1, samples.size()) - 1];
+}
+
+struct PhaseSamples {
+    std::string                              d_name;
+    std::vector<std::int64_t>                d_wallNs;
+    std::array<std::vector<std::int64_t>, 4> d_counts;
+    std::array<std::int64_t, 4>              d_memory = { -1, -1, -1, -1 };
+};
+
+// Print a tab and then 'value', or '-' if it is negative.
+void printOptional(std::int64_t value)
+{
+    std::cout << '\t';
+    if (value >= 0)
+        std::cout << value;
+    else
+        std::cout << '-';
+}
+
+void bench(const Solution& solution, int numRuns)
+{
+    // in first-reported order
+    std::vector<PhaseSamples> phases;
+    for (int run = 0; run < numRuns; ++run) {
+        std::vector<std::string> lines;
+        if (const int status = runOnce(solution, lines);
+            !WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+            std::cerr << solution.d_binary.string() << ": run failed"
+                      << std::endl;
+            return;
+        }
+        for (const std::string_view line : lines) {
+            const auto         tab    = line.find('\t');
+            const std::int64_t wallNs = fieldValue(line, "wall_ns");
+            if ((tab == std::string_view::npos) || (wallNs < 0))
+                continue;
+
+            const std::string_view name = line.substr(0, tab);
+            auto it = std::find_if(phases.begin(), phases.end(),
+                                   [&](const auto& p) {
+                                       return p.d_name == name;
+                                   });
+            if (it == phases.end())
+                it = phases.insert(phases.end(), { std::string(name) });
+
+            it->d_wallNs.push_back(wallNs);
+            for (std::size_t i = 0; i < k_CounterKeys.size(); ++i) {
+                if (const std::int64_t count = fieldValue(line,
+                                                          k_CounterKeys[i]);
+                    count >= 0)
+                    it->d_counts[i].push_back(count);
+            }
+            for (std::size_t i = 0; i < k_MemoryKeys.size(); ++i)
+                it->d_memory[i] = std::max(it->d_memory[i],
+                                           fieldValue(line, k_MemoryKeys[i]));
+        }
+    }
+    if (phases.empty()) {
+        std::cerr << solution.d_binary.string() << ": no phases reported"
+                  << std::endl;
+        return;
+    }
+    for (auto& [name, samples, counts, memory] : phases) {
+        std::sort(samples.begin(), samples.end());
+        std::cout << solution.d_name   << '\t'
+                  << solution.d_year   << '\t'
+                  << solution.d_day    << '\t'
+                  << solution.d_part   << '\t'
+                  << name              << '\t'
+                  << samples.size()    << '\t'
+                  << samples.front()   << '\t'
+                  << percentile(samples, 0.50) << '\t'
+                  << percentile(samples, 0.99);
+        for (std::vector<std::int64_t>& values : counts) {
+            std::sort(values.begin(), values.end());
+            printOptional(values.empty() ? -1 : percentile(values, 0.50));
+        }
+        for (const std::int64_t value : memory)
+            printOptional(value);
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int numRuns = 10;
+    std::vector<Solution> solutions;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-n") && (i + 1 < argc)) {
+            numRuns = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            solutions.push_back(makeSolution(arg));
+        }
+    }
+    if (solutions.empty()) {
+        std::cerr << "usage: " << argv[0] << " [-n RUNS] BINARY..."
+                  << std::endl;
+        return 2;
+    }
+    std::sort(solutions.begin(), solutions.end(),
+              [](const Solution& lhs, const Solution& rhs) {
+                  return std::tie(lhs.d_year, lhs.d_day, lhs.d_part) <
+                         std::tie(rhs.d_year, rhs.d_day, rhs.d_part);
+              });
+
+    std::cout << "solution\tyear\tday\tpart\tphase\truns"
+                 "\tmin_ns\tmedian_ns\tp99_ns\tcycles\tinstructions"
+                 "\tcache_misses\tbranch_misses\tallocs\talloc_bytes"
+                 "\tpeak_heap_bytes\tpeak_rss_bytes" << std::endl;
+    for (const Solution& solution : solutions)
+        bench(solution, numRuns);
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Compare how long solution binaries take from launch to exit, e.g. the
+// 'make release' builds against the 'make embed' ones, which carry their input
+// (and for some days their answer) compiled in:
+//..
+//  $ startup [-n RUNS] [-t TIMEOUT] BINARY...
+//  solution    build  runs  min_ns  median_ns  speedup
+//..
+// Each binary is started 'RUNS' times in its own directory (where its input
+// lives) with its output discarded, and the whole process is timed, from
+// 'fork' to reaping it; a binary that fails or runs for over 'TIMEOUT'
+// seconds (10 by default) is listed on stderr and skipped.  'build' is what
+// follows the last '-' of the binary's name.  For every build other than
+// "release", 'speedup' is the median of the same solution's "release" build
+// over its own median, or '-' if that build was not given.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using Clock = std::chrono::steady_clock;
+
+struct Binary {
+    std::filesystem::path d_path;
+    std::string           d_solution;  // e.g. "day_25-code_chronicle-part_1"
+    std::string           d_build;     // e.g. "embed"
+    std::int64_t          d_minNs    = 0;
+    std::int64_t          d_medianNs = 0;
+};
+
+// Run 'binary' once in its directory with its output discarded, killing it
+// after 'timeout' seconds, and return its wall time, or -1 if it failed.
+std::int64_t runOnce(const std::filesystem::path& binary, unsigned timeout)
+{
+    const auto  start = Clock::now();
+    const pid_t pid   = ::fork();
+    if (pid == 0) {
+        const int devNull = ::open("/dev/null", O_WRONLY);
+        ::dup2(devNull, STDOUT_FILENO);
+        ::dup2(devNull, STDERR_FILENO);
+        if (::chdir(binary.parent_path().c_str()) != 0)
+            ::_exit(127);
+
+        ::alarm(timeout);
+        const std::string path = binary.string();
+        ::execl(path.c_str(), path.c_str(), static_cast<char *>(nullptr));
+        ::_exit(127);
+    }
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    const std::int64_t wallNs =
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? wallNs : -1;
+}
+
+int main(int argc, char *argv[])
+{
+    int                 numRuns = 10;
+    unsigned            timeout = 10;
+    std::vector<Binary> binaries;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-n") && (i + 1 < argc)) {
+            numRuns = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-t") && (i + 1 < argc)) {
+            timeout = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg.starts_with('-')) {
+            std::cerr << "usage: " << argv[0]
+                      << " [-n RUNS] [-t TIMEOUT] BINARY..." << std::endl;
+            return 2;
+        }
+        else {
+            Binary& binary = binaries.emplace_back();
+            binary.d_path = std::filesystem::absolute(arg);
+            const std::string name = binary.d_path.filename().string();
+            const auto        dash = name.rfind('-');
+            binary.d_solution = name.substr(0, dash);
+            binary.d_build    = dash == std::string::npos
+                              ? std::string()
+                              : name.substr(dash + 1);
+        }
+    }
+
+    int status = 0;
+    for (Binary& binary : binaries) {
+        std::vector<std::int64_t> wallNs;
+        for (int run = 0; run < numRuns; ++run) {
+            const std::int64_t ns = runOnce(binary.d_path, timeout);
+            if (ns < 0) {
+                std::cerr << binary.d_path.string() << " failed" << std::endl;
+                status = 1;
+                break;
+            }
+            wallNs.push_back(ns);
+        }
+        if (wallNs.empty())
+            continue;
+        std::sort(wallNs.begin(), wallNs.end());
+        binary.d_minNs    = wallNs.front();
+        binary.d_medianNs = wallNs[wallNs.size() / 2];
+    }
+
+    std::map<std::string, std::int64_t> releaseMedianNs;
+    for (const Binary& binary : binaries) {
+        if (binary.d_build == "release" && binary.d_medianNs > 0)
+            releaseMedianNs[binary.d_solution] = binary.d_medianNs;
+    }
+    std::cout << "solution\tbuild\truns\tmin_ns\tmedian_ns\tspeedup"
+              << std::endl;
+    for (const Binary& binary : binaries) {
+        if (binary.d_medianNs == 0)
+            continue;
+        std::cout << binary.d_solution << '\t'
+                  << binary.d_build    << '\t'
+                  << numRuns           << '\t'
+                  << binary.d_minNs    << '\t'
+                  << binary.d_medianNs << '\t';
+        const auto it = releaseMedianNs.find(binary.d_solution);
+        if (binary.d_build != "release" && it != releaseMedianNs.end())
+            std::cout << double(it->second) / double(binary.d_medianNs);
+        else
+            std::cout << '-';
+        std::cout << std::endl;
+    }
+    return status;
+}
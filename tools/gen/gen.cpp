@@ -0,0 +1,67 @@
+// Write a synthetic puzzle input for one day to stdout:
+//..
+//  $ gen [-s SEED] DAY [SIZE] > input.txt
+//  $ gen -l
+//..
+// 'DAY' is a day directory such as '2024/06'.  What 'SIZE' counts depends on
+// the day (its default is about the size of the real input); '-l' lists it
+// for every day, along with the range that the day's solutions accept.  The
+// same seed (0 by default) and size always give the same input.
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#include "generators.h"
+
+int main(int argc, char *argv[])
+{
+    std::uint64_t    seed = 0;
+    std::string_view day;
+    std::int64_t     size = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "-l") {
+            std::cout << "day\tsize\tdefault\tmin\tmax" << std::endl;
+            for (const Generator& generator : generators())
+                std::cout << generator.d_day         << '\t'
+                          << generator.d_size        << '\t'
+                          << generator.d_defaultSize << '\t'
+                          << generator.d_minSize     << '\t'
+                          << generator.d_maxSize     << std::endl;
+            return 0;
+        }
+        else if ((arg == "-s") && (i + 1 < argc)) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (day.empty() && !arg.starts_with('-')) {
+            day = arg;
+        }
+        else if (!size && !arg.starts_with('-')) {
+            size = std::atoll(argv[i]);
+        }
+        else {
+            day = {};
+            break;
+        }
+    }
+    const Generator *generator = day.empty() ? nullptr : findGenerator(day);
+    if (!generator) {
+        std::cerr << "usage: " << argv[0] << " [-s SEED] DAY [SIZE]\n"
+                  << "       " << argv[0] << " -l" << std::endl;
+        return 2;
+    }
+
+    if (!size)
+        size = generator->d_defaultSize;
+    if (size < generator->d_minSize || size > generator->d_maxSize) {
+        std::cerr << generator->d_day << ": size must be in ["
+                  << generator->d_minSize << ", " << generator->d_maxSize
+                  << "] " << generator->d_size << std::endl;
+        return 2;
+    }
+    Rng rng(seed);
+    generator->d_generate(std::cout, size, rng);
+    return std::cout.flush() ? 0 : 1;
+}
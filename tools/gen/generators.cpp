@@ -0,0 +1,1097 @@
+// Per-day synthetic input generators.  Each one follows the format of its
+// day's '*-input.txt' and the assumptions its solutions make about it, e.g.
+// that the guard of 2024/06 eventually leaves the lab or that the program of
+// 2024/17 has a solution.
+
+#include "generators.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Rows = std::vector<std::string>;
+
+// Uniformly distributed integer in '[low, high]'.
+std::int64_t uniform(Rng& rng, std::int64_t low, std::int64_t high)
+{
+    return std::uniform_int_distribution<std::int64_t>(low, high)(rng);
+}
+
+bool chance(Rng& rng, double probability)
+{
+    return std::bernoulli_distribution(probability)(rng);
+}
+
+char pick(Rng& rng, std::string_view chars)
+{
+    return chars[uniform(rng, 0, chars.size() - 1)];
+}
+
+std::string randomString(Rng& rng, std::int64_t size, std::string_view chars)
+{
+    std::string str(size, ' ');
+    for (char& c : str)
+        c = pick(rng, chars);
+    return str;
+}
+
+void writeRows(std::ostream& out, const Rows& rows)
+{
+    for (const std::string& row : rows)
+        out << row << '\n';
+}
+
+// Return the name of 'index' in base 26 with exactly 'width' lowercase
+// letters.
+std::string letterName(std::int64_t index, int width)
+{
+    std::string name(width, 'a');
+    for (int i = width - 1; i >= 0; --i, index /= 26)
+        name[i] = 'a' + index % 26;
+    return name;
+}
+
+// Return a perfect maze of '#' walls and '.' passages, 'side' (odd) cells
+// wide, in which every odd cell is a passage, with 'numLoops' extra walls
+// knocked out so that there is more than one way around.
+Rows makeMaze(std::int64_t side, std::int64_t numLoops, Rng& rng)
+{
+    assert(side % 2 == 1);
+
+    Rows maze(side, std::string(side, '#'));
+    constexpr int k_Dir[] = { 0, 2, 0, -2, 0 };
+    std::vector<std::pair<std::int64_t, std::int64_t>> stack = { { 1, 1 } };
+    maze[1][1] = '.';
+    while (!stack.empty()) {
+        const auto [i, j] = stack.back();
+        std::array<int, 4> dirs = { 0, 1, 2, 3 };
+        std::shuffle(dirs.begin(), dirs.end(), rng);
+        bool moved = false;
+        for (const int d : dirs) {
+            const std::int64_t nI = i + k_Dir[d], nJ = j + k_Dir[d+1];
+            if (nI > 0 && nI < side - 1 && nJ > 0 && nJ < side - 1 &&
+                maze[nI][nJ] == '#') {
+                maze[(i + nI) / 2][(j + nJ) / 2] = '.';
+                maze[nI][nJ] = '.';
+                stack.emplace_back(nI, nJ);
+                moved = true;
+                break;
+            }
+        }
+        if (!moved)
+            stack.pop_back();
+    }
+    for (std::int64_t k = 0; k < numLoops && side > 3; ++k) {
+        const std::int64_t i = uniform(rng, 1, side - 2),
+                           j = uniform(rng, 1, side - 2);
+        if ((i + j) % 2 == 1)
+            maze[i][j] = '.';
+    }
+    return maze;
+}
+
+// ============================================================================
+//                                   2024
+// ----------------------------------------------------------------------------
+
+void gen2024_01(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    std::vector<std::int64_t> left(size);
+    for (std::int64_t& value : left)
+        value = uniform(rng, 10000, 99999);
+    for (std::int64_t i = 0; i < size; ++i) {
+        const std::int64_t right = chance(rng, 0.5)
+                                 ? left[uniform(rng, 0, size - 1)]
+                                 : uniform(rng, 10000, 99999);
+        out << left[i] << "   " << right << '\n';
+    }
+}
+
+void gen2024_02(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t r = 0; r < size; ++r) {
+        const std::int64_t numLevels = uniform(rng, 5, 8),
+                           sign      = chance(rng, 0.5) ? 1 : -1;
+        std::int64_t level = sign > 0 ? uniform(rng, 1, 40)
+                                      : uniform(rng, 60, 99);
+        for (std::int64_t l = 0; l < numLevels; ++l) {
+            out << (l ? " " : "") << level;
+            std::int64_t step = sign * uniform(rng, 1, 3);
+            if (chance(rng, 0.08))
+                step = uniform(rng, -5, 5);
+            level = std::clamp<std::int64_t>(level + step, 1, 99);
+        }
+        out << '\n';
+    }
+}
+
+void gen2024_03(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    constexpr std::string_view k_Noise = "()[]{}<>,;:'!?@#$%^&*+- whatfromhowselect";
+    for (std::int64_t line = 0; line < size; ++line) {
+        std::string memory;
+        while (memory.size() < 3000) {
+            switch (uniform(rng, 0, 11)) {
+              case 0:
+              case 1:
+                memory += "mul(" + std::to_string(uniform(rng, 1, 999)) +
+                          ',' + std::to_string(uniform(rng, 1, 999)) + ')';
+                break;
+              case 2:
+                memory += chance(rng, 0.5) ? "do()" : "don't()";
+                break;
+              case 3:
+                memory += "mul(" + std::to_string(uniform(rng, 1, 999)) + ']';
+                break;
+              default:
+                memory += randomString(rng, uniform(rng, 1, 8), k_Noise);
+            }
+        }
+        out << memory << '\n';
+    }
+}
+
+void gen2024_04(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t i = 0; i < size; ++i)
+        out << randomString(rng, size, "XMAS") << '\n';
+}
+
+void gen2024_05(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Every pair of the pages is ordered by a rule, consistently with one
+    // total order.
+    std::vector<std::int64_t> pages(49);
+    std::iota(pages.begin(), pages.end(), 11);
+    std::shuffle(pages.begin(), pages.end(), rng);
+    std::vector<std::pair<std::int64_t, std::int64_t>> rules;
+    for (std::size_t i = 0; i < pages.size(); ++i)
+        for (std::size_t j = i + 1; j < pages.size(); ++j)
+            rules.emplace_back(pages[i], pages[j]);
+    std::shuffle(rules.begin(), rules.end(), rng);
+    for (const auto& [before, after] : rules)
+        out << before << '|' << after << '\n';
+    out << '\n';
+
+    for (std::int64_t u = 0; u < size; ++u) {
+        std::vector<std::int64_t> order(pages.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), rng);
+        order.resize(2 * uniform(rng, 2, 11) + 1);
+        if (chance(rng, 0.5))
+            std::sort(order.begin(), order.end());
+        const char *sep = "";
+        for (const std::int64_t o : order)
+            out << std::exchange(sep, ",") << pages[o];
+        out << '\n';
+    }
+}
+
+// Change 'lab' so that the guard walking it from '^' visits about
+// 'routeShare' of its cells (as in the real inputs) and then leaves.  Where
+// she would step off the map too soon, or is about to walk in a loop, an
+// obstacle is added on the last cell she has walked onto just once, so that
+// she turns on the cell before instead, and her walk is replayed from there.
+// If there is no such cell, the obstacle that turned her last goes instead.
+// No cell changes more than twice, so she always leaves in the end.
+void makeGuardLeave(Rows& lab, double routeShare)
+{
+    const std::int64_t side = lab.size();
+    constexpr int k_Dir[] = { -1, 0, +1, 0, -1 };
+
+    // Her states, 'cell * 4 + direction', in the order she is in them, and
+    // which of them she has been in, and when she first ran into each cell.
+    std::vector<std::int64_t> route;
+    std::vector<std::uint8_t> seen(side * side), changed(side * side);
+    std::vector<std::int64_t> firstHit(side * side, -1);
+    std::int64_t              numVisited = 0;
+    const auto ahead = [&](std::int64_t state) -> std::int64_t {
+        const std::int64_t i = state / 4 / side + k_Dir[state % 4],
+                           j = state / 4 % side + k_Dir[state % 4 + 1];
+        return i < 0 || i >= side || j < 0 || j >= side ? -1 : i * side + j;
+    };
+    const auto at = [&](std::int64_t cell) -> char& {
+        return lab[cell / side][cell % side];
+    };
+
+    // Forget her walk from 'route[k]' on.
+    const auto rewind = [&](std::size_t k) {
+        for (std::size_t r = k; r < route.size(); ++r) {
+            std::uint8_t& mask = seen[route[r] / 4];
+            mask &= ~(1 << route[r] % 4);
+            numVisited -= !mask;
+            if (const std::int64_t next = ahead(route[r]);
+                next >= 0 && firstHit[next] == std::int64_t(r))
+                firstHit[next] = -1;
+        }
+        route.resize(k);
+    };
+
+    // Add an obstacle on the cell of 'route[k]' and return the state she is
+    // in instead, or return -1 if that would change her walk before.
+    const auto blockAt = [&](std::size_t k) -> std::int64_t {
+        const std::int64_t cell = route[k] / 4;
+        if (k == 0 || changed[cell] || seen[cell] != 1 << route[k] % 4 ||
+            route[k - 1] / 4 == cell)
+            return -1;
+
+        rewind(k);
+        at(cell) = '#';
+        changed[cell]  = 1;
+        firstHit[cell] = k - 1;
+        return route[k - 1] / 4 * 4 + (route[k - 1] % 4 + 1) % 4;
+    };
+
+    // Add an obstacle as late on her route as possible, and return the state
+    // she is in instead, or -1 if there is nowhere to add one.
+    const auto block = [&] {
+        std::int64_t turned = -1;
+        for (std::size_t k = route.size() - 1; k > 0 && turned < 0; --k)
+            turned = blockAt(k);
+        return turned;
+    };
+
+    std::int64_t start = 0;
+    while (lab[start].find('^') == std::string::npos)
+        ++start;
+    std::int64_t state = (start * side + lab[start].find('^')) * 4;
+    for (;;) {
+        const std::int64_t cell = state / 4;
+        const int          dir  = state % 4;
+        if (seen[cell] & (1 << dir)) {
+            if (const std::int64_t turned = block(); turned >= 0) {
+                state = turned;
+                continue;
+            }
+
+            std::int64_t turn = route.size() - 1;
+            while (ahead(route[turn]) < 0 || at(ahead(route[turn])) != '#')
+                --turn;
+            const std::int64_t obstacle = ahead(route[turn]),
+                               replay   = firstHit[obstacle];
+            at(obstacle)      = '.';
+            changed[obstacle] = 1;
+            state = route[replay];
+            rewind(replay);
+            continue;
+        }
+        numVisited += !seen[cell];
+        seen[cell] |= 1 << dir;
+        route.push_back(state);
+
+        const std::int64_t next = ahead(state);
+        if (next < 0) {
+            const std::int64_t turned =
+                        numVisited < routeShare * side * side ? block() : -1;
+            if (turned < 0)
+                return;
+            state = turned;
+            continue;
+        }
+        if (at(next) == '#') {
+            if (firstHit[next] < 0)
+                firstHit[next] = route.size() - 1;
+            state = cell * 4 + (dir + 1) % 4;
+        }
+        else {
+            state = next * 4 + dir;
+        }
+    }
+}
+
+void gen2024_06(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    Rows lab(size, std::string(size, '.'));
+    for (std::string& row : lab)
+        for (char& cell : row)
+            cell = chance(rng, 0.05) ? '#' : '.';
+    lab[uniform(rng, size / 4, 3 * size / 4)]
+       [uniform(rng, size / 4, 3 * size / 4)] = '^';
+    makeGuardLeave(lab, 0.3);
+    writeRows(out, lab);
+}
+
+void gen2024_07(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    constexpr std::int64_t k_MaxTarget = 1'000'000'000'000'000;
+    for (std::int64_t e = 0; e < size; ) {
+        std::vector<std::int64_t> operands(uniform(rng, 2, 12));
+        for (std::int64_t& operand : operands)
+            operand = chance(rng, 0.7) ? uniform(rng, 1, 9)
+                                       : uniform(rng, 10, 999);
+        std::int64_t target = operands[0];
+        for (std::size_t i = 1; i < operands.size() && target < k_MaxTarget;
+             ++i) {
+            switch (uniform(rng, 0, 2)) {
+              case 0:
+                target += operands[i];
+                break;
+              case 1:
+                target *= operands[i];
+                break;
+              default:
+                for (std::int64_t o = operands[i]; o > 0; o /= 10)
+                    target *= 10;
+                target += operands[i];
+            }
+        }
+        if (target >= k_MaxTarget)
+            continue;
+
+        out << target + chance(rng, 0.4) << ':';
+        for (const std::int64_t operand : operands)
+            out << ' ' << operand;
+        out << '\n';
+        ++e;
+    }
+}
+
+void gen2024_08(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    constexpr std::string_view k_Frequencies =
+       "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    Rows map(size, std::string(size, '.'));
+    for (std::int64_t a = 0; a < size * size / 12; ++a)
+        map[uniform(rng, 0, size - 1)][uniform(rng, 0, size - 1)] =
+                                                     pick(rng, k_Frequencies);
+    writeRows(out, map);
+}
+
+void gen2024_09(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    std::string diskMap(size | 1, '0');
+    for (std::size_t i = 0; i < diskMap.size(); ++i)
+        diskMap[i] += i % 2 ? uniform(rng, 0, 9) : uniform(rng, 1, 9);
+    out << diskMap << '\n';
+}
+
+void gen2024_10(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Random heights with hiking trails from 0 to 9 carved into them.
+    Rows map(size);
+    for (std::string& row : map)
+        row = randomString(rng, size, "0123456789");
+    constexpr int k_Dir[] = { 0, +1, 0, -1, 0 };
+    for (std::int64_t t = 0; t < size * size / 20; ++t) {
+        std::int64_t i = uniform(rng, 0, size - 1),
+                     j = uniform(rng, 0, size - 1);
+        for (char height = '0'; height <= '9'; ++height) {
+            map[i][j] = height;
+            const int d = uniform(rng, 0, 3);
+            i = std::clamp<std::int64_t>(i + k_Dir[d],   0, size - 1);
+            j = std::clamp<std::int64_t>(j + k_Dir[d+1], 0, size - 1);
+        }
+    }
+    writeRows(out, map);
+}
+
+void gen2024_11(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t s = 0; s < size; ++s)
+        out << (s ? " " : "") << uniform(rng, 0, 9'999'999);
+    out << '\n';
+}
+
+void gen2024_12(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Grow regions from random seeds, breadth first, so each is contiguous.
+    Rows garden(size, std::string(size, ' '));
+    std::deque<std::pair<std::int64_t, std::int64_t>> frontier;
+    for (std::int64_t s = 0; s < std::max<std::int64_t>(1, size * size / 40);
+         ++s) {
+        const std::int64_t i = uniform(rng, 0, size - 1),
+                           j = uniform(rng, 0, size - 1);
+        garden[i][j] = 'A' + uniform(rng, 0, 25);
+        frontier.emplace_back(i, j);
+    }
+    constexpr int k_Dir[] = { 0, +1, 0, -1, 0 };
+    while (!frontier.empty()) {
+        const auto [i, j] = frontier.front();
+        frontier.pop_front();
+        for (int d = 0; d < 4; ++d) {
+            const std::int64_t nI = i + k_Dir[d], nJ = j + k_Dir[d+1];
+            if (nI >= 0 && nI < size && nJ >= 0 && nJ < size &&
+                garden[nI][nJ] == ' ') {
+                garden[nI][nJ] = garden[i][j];
+                frontier.emplace_back(nI, nJ);
+            }
+        }
+    }
+    writeRows(out, garden);
+}
+
+void gen2024_13(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t m = 0; m < size; ) {
+        const std::int64_t ax = uniform(rng, 10, 99), ay = uniform(rng, 10, 99),
+                           bx = uniform(rng, 10, 99), by = uniform(rng, 10, 99);
+        if (ax * by == ay * bx)
+            continue;
+
+        const std::int64_t a = uniform(rng, 1, 100), b = uniform(rng, 1, 100),
+                           miss = chance(rng, 0.5) ? uniform(rng, 1, 50) : 0;
+        out << (m++ ? "\n" : "")
+            << "Button A: X+" << ax << ", Y+" << ay << '\n'
+            << "Button B: X+" << bx << ", Y+" << by << '\n'
+            << "Prize: X=" << a * ax + b * bx + miss
+            << ", Y=" << a * ay + b * by << '\n';
+    }
+}
+
+void gen2024_14(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // The solutions hardcode the 101x103 room.
+    for (std::int64_t r = 0; r < size; ++r)
+        out << "p=" << uniform(rng, 0, 100) << ',' << uniform(rng, 0, 102)
+            << " v=" << uniform(rng, -99, 99) << ',' << uniform(rng, -99, 99)
+            << '\n';
+}
+
+void gen2024_15(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    Rows warehouse(size, std::string(size, '#'));
+    for (std::int64_t i = 1; i < size - 1; ++i)
+        for (std::int64_t j = 1; j < size - 1; ++j)
+            warehouse[i][j] = chance(rng, 0.05) ? '#'
+                            : chance(rng, 0.3)  ? 'O'
+                            :                     '.';
+    warehouse[size / 2][size / 2] = '@';
+    writeRows(out, warehouse);
+    out << '\n';
+    for (std::int64_t m = 8 * size * size; m > 0; m -= 1000)
+        out << randomString(rng, std::min<std::int64_t>(m, 1000), "<>^v")
+            << '\n';
+}
+
+void gen2024_16(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    Rows maze = makeMaze(size | 1, size * size / 40, rng);
+    maze[maze.size() - 2][1] = 'S';
+    maze[1][maze.size() - 2] = 'E';
+    writeRows(out, maze);
+}
+
+// Return the output of the 2024/17 'program' started with 'a' in register A.
+std::vector<int> runProgram(const std::vector<int>& program, std::int64_t a)
+{
+    std::int64_t reg[3] = { a, 0, 0 };
+    std::vector<int> output;
+    for (std::size_t ip = 0; ip + 1 < program.size(); ip += 2) {
+        const int literal = program[ip + 1];
+        const std::int64_t combo = literal < 4 ? literal
+                                 : literal < 7 ? reg[literal - 4]
+                                 :               0;
+        switch (program[ip]) {
+          case 0: reg[0] = reg[0] >> combo;      break;
+          case 1: reg[1] ^= literal;             break;
+          case 2: reg[1] = combo % 8;            break;
+          case 3: if (reg[0]) ip = literal - 2;  break;
+          case 4: reg[1] ^= reg[2];              break;
+          case 5: output.push_back(combo % 8);   break;
+          case 6: reg[1] = reg[0] >> combo;      break;
+          case 7: reg[2] = reg[0] >> combo;      break;
+        }
+    }
+    return output;
+}
+
+// Return whether fixing the digits of register A from the most significant
+// one down, taking the smallest digit that reproduces the corresponding
+// output, finds a value that makes 'program' output itself; this is the
+// search part 2 does, without backtracking.
+bool isSolvableQuine(const std::vector<int>& program)
+{
+    std::int64_t base = 1;
+    for (std::size_t i = 1; i < program.size(); ++i)
+        base *= 8;
+    std::int64_t total = base;
+    for (std::int64_t pos = program.size() - 1; pos >= 0; --pos, base /= 8) {
+        std::int64_t mult = 0;
+        for ( ; mult < 64; ++mult) {
+            const auto output = runProgram(program, total + base * mult);
+            if (output.size() != program.size())
+                return false;
+            if (output[pos] == program[pos])
+                break;
+        }
+        if (mult == 64)
+            return false;
+        total += base * mult;
+    }
+    return runProgram(program, total) == program;
+}
+
+void gen2024_17(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Any program shaped like the real one outputs one octal digit per
+    // digit of register A, so 'size' is the number of digits of A.
+    std::vector<int> program;
+    do {
+        program = { 2, 4, 1, int(uniform(rng, 1, 7)), 7, 5, 0, 3,
+                    1, int(uniform(rng, 1, 7)), 4, int(uniform(rng, 0, 7)),
+                    5, 5, 3, 0 };
+    } while (!isSolvableQuine(program));
+
+    std::int64_t a = uniform(rng, 1, 7);
+    for (std::int64_t d = 1; d < size; ++d)
+        a = a * 8 + uniform(rng, 0, 7);
+    out << "Register A: " << a << "\nRegister B: 0\nRegister C: 0\n\n"
+        << "Program: ";
+    for (std::size_t i = 0; i < program.size(); ++i)
+        out << (i ? "," : "") << program[i];
+    out << '\n';
+}
+
+// Return whether the corners of the 'side'x'side' memory space are still
+// connected after the first 'numBytes' of 'bytes' have fallen.
+bool isConnected(std::int64_t                                         side,
+                 const std::vector<std::pair<std::int64_t, std::int64_t>>& bytes,
+                 std::size_t                                          numBytes)
+{
+    std::vector<std::uint8_t> blocked(side * side);
+    for (std::size_t b = 0; b < numBytes; ++b)
+        blocked[bytes[b].second * side + bytes[b].first] = 1;
+    std::vector<std::int64_t> stack = { 0 };
+    blocked[0] = 1;
+    while (!stack.empty()) {
+        const std::int64_t n = stack.back(), x = n % side, y = n / side;
+        stack.pop_back();
+        if (n == side * side - 1)
+            return true;
+
+        for (const std::int64_t next : { x > 0        ? n - 1    : -1,
+                                         x < side - 1 ? n + 1    : -1,
+                                         y > 0        ? n - side : -1,
+                                         y < side - 1 ? n + side : -1 }) {
+            if (next >= 0 && !blocked[next]) {
+                blocked[next] = 1;
+                stack.push_back(next);
+            }
+        }
+    }
+    return false;
+}
+
+void gen2024_18(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Both parts hardcode the 71x71 memory space and part 1 simulates the
+    // first 1024 bytes, so the corners must stay connected that long; part 2
+    // needs the bytes to cut them off eventually.
+    constexpr std::int64_t k_Side = 71;
+    std::vector<std::pair<std::int64_t, std::int64_t>> bytes;
+    for (std::int64_t y = 0; y < k_Side; ++y)
+        for (std::int64_t x = 0; x < k_Side; ++x)
+            if ((x || y) && (x != k_Side - 1 || y != k_Side - 1))
+                bytes.emplace_back(x, y);
+
+    std::size_t cutoff;
+    do {
+        std::shuffle(bytes.begin(), bytes.end(), rng);
+        std::size_t low = 0, high = bytes.size();
+        while (low < high) {
+            const std::size_t mid = (low + high) / 2;
+            if (isConnected(k_Side, bytes, mid + 1))
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        cutoff = low + 1;
+    } while (cutoff <= 1024);
+
+    bytes.resize(std::max<std::size_t>(cutoff, size));
+    for (const auto& [x, y] : bytes)
+        out << x << ',' << y << '\n';
+}
+
+void gen2024_19(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Part 2's trie has 16-bit node indices, so the set of towel patterns
+    // stays the size of the real one.  No single white stripe, as there.
+    std::vector<std::string> patterns = { "r", "b", "g", "u" };
+    while (patterns.size() < 447) {
+        std::string pattern = randomString(rng, uniform(rng, 2, 8), "wubrg");
+        if (std::find(patterns.begin(), patterns.end(), pattern) ==
+                                                               patterns.end())
+            patterns.push_back(std::move(pattern));
+    }
+    std::shuffle(patterns.begin(), patterns.end(), rng);
+    for (std::size_t p = 0; p < patterns.size(); ++p)
+        out << (p ? ", " : "") << patterns[p];
+    out << "\n\n";
+
+    for (std::int64_t d = 0; d < size; ++d) {
+        const std::int64_t length = uniform(rng, 20, 60);
+        std::string design;
+        if (chance(rng, 0.6)) {
+            while (std::int64_t(design.size()) < length)
+                design += patterns[uniform(rng, 0, patterns.size() - 1)];
+        }
+        else {
+            design = randomString(rng, length, "wubrg");
+        }
+        out << design << '\n';
+    }
+}
+
+void gen2024_20(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    Rows track = makeMaze(size | 1, 0, rng);
+    track[track.size() - 2][1] = 'S';
+    track[1][track.size() - 2] = 'E';
+    writeRows(out, track);
+}
+
+void gen2024_21(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t c = 0; c < size; ++c)
+        out << randomString(rng, 3, "0123456789") << "A\n";
+}
+
+void gen2024_22(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t s = 0; s < size; ++s)
+        out << uniform(rng, 1, (1 << 24) - 1) << '\n';
+}
+
+void gen2024_23(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Computers have two-letter names, which bounds the network to 676 of
+    // them.  Each is linked to about 13 others and one set of 13 is fully
+    // connected, as in the real input.
+    std::vector<std::int64_t> computers(26 * 26);
+    std::iota(computers.begin(), computers.end(), 0);
+    std::shuffle(computers.begin(), computers.end(), rng);
+    computers.resize(size);
+
+    std::vector<std::pair<std::int64_t, std::int64_t>> links;
+    const auto link = [&](std::int64_t a, std::int64_t b) {
+        const std::pair<std::int64_t, std::int64_t> l =
+                                    std::minmax(computers[a], computers[b]);
+        if (a != b &&
+            std::find(links.begin(), links.end(), l) == links.end())
+            links.push_back(l);
+    };
+    for (std::int64_t a = 0; a < 13; ++a)
+        for (std::int64_t b = a + 1; b < 13; ++b)
+            link(a, b);
+    for (std::int64_t a = 13; a < size; ++a)
+        for (int l = 0; l < 6; ++l)
+            link(a, uniform(rng, 0, size - 1));
+    std::shuffle(links.begin(), links.end(), rng);
+    for (auto [a, b] : links) {
+        if (chance(rng, 0.5))
+            std::swap(a, b);
+        out << letterName(a, 2) << '-' << letterName(b, 2) << '\n';
+    }
+}
+
+void gen2024_24(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // A ripple-carry adder of 'size'-bit numbers with the outputs of four
+    // pairs of gates swapped, each pair within one full adder.  Part 1
+    // evaluates 'z' into 64 bits, which bounds 'size' to 63.
+    const auto bitName = [](char wire, std::int64_t bit) {
+        return wire + std::to_string(bit / 10) + std::to_string(bit % 10);
+    };
+    std::vector<std::int64_t> names(23 * 26 * 26);
+    std::iota(names.begin(), names.end(), 0);
+    std::shuffle(names.begin(), names.end(), rng);
+    std::size_t nextName = 0;
+    const auto newWire = [&] { return letterName(names[nextName++], 3); };
+
+    struct Gate {
+        std::string d_in1, d_op, d_in2, d_out;
+    };
+    std::vector<Gate> gates;
+    // For each bit: the gates producing 'x ^ y', 'x & y', 'z', the carry
+    // through 'x ^ y' and the carry out, by index into 'gates'.
+    std::vector<std::array<std::size_t, 5>> adders(size);
+    std::string carry;
+    for (std::int64_t bit = 0; bit < size; ++bit) {
+        const std::string x = bitName('x', bit), y = bitName('y', bit);
+        const std::string z = bitName('z', bit);
+        auto& adder = adders[bit];
+        if (bit == 0) {
+            gates.push_back({ x, "XOR", y, z });
+            carry = newWire();
+            gates.push_back({ x, "AND", y, carry });
+            continue;
+        }
+        const std::string sum = newWire(), both = newWire(),
+                          through = newWire(),
+                          carryOut = bit + 1 < size ? newWire()
+                                                    : bitName('z', size);
+        adder[0] = gates.size(); gates.push_back({ x, "XOR", y, sum });
+        adder[1] = gates.size(); gates.push_back({ x, "AND", y, both });
+        adder[2] = gates.size(); gates.push_back({ sum, "XOR", carry, z });
+        adder[3] = gates.size(); gates.push_back({ sum, "AND", carry,
+                                                   through });
+        adder[4] = gates.size(); gates.push_back({ both, "OR", through,
+                                                   carryOut });
+        carry = carryOut;
+    }
+
+    // Swap within four distinct adders, away from both ends.
+    std::vector<std::int64_t> bits;
+    for (std::int64_t bit = 2; bit + 2 < size; bit += 2)
+        bits.push_back(bit);
+    std::shuffle(bits.begin(), bits.end(), rng);
+    constexpr std::pair<int, int> k_Swaps[] = { { 0, 1 }, { 2, 4 }, { 2, 3 } };
+    for (int s = 0; s < 4; ++s) {
+        const auto [g1, g2] = k_Swaps[uniform(rng, 0, 2)];
+        std::swap(gates[adders[bits[s]][g1]].d_out,
+                  gates[adders[bits[s]][g2]].d_out);
+    }
+
+    for (const char wire : { 'x', 'y' })
+        for (std::int64_t bit = 0; bit < size; ++bit)
+            out << bitName(wire, bit) << ": " << uniform(rng, 0, 1) << '\n';
+    out << '\n';
+    std::shuffle(gates.begin(), gates.end(), rng);
+    for (Gate& gate : gates) {
+        if (chance(rng, 0.5))
+            std::swap(gate.d_in1, gate.d_in2);
+        out << gate.d_in1 << ' ' << gate.d_op << ' ' << gate.d_in2 << " -> "
+            << gate.d_out << '\n';
+    }
+}
+
+void gen2024_25(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t s = 0; s < size; ++s) {
+        const bool isLock = chance(rng, 0.5);
+        std::array<std::int64_t, 5> heights;
+        for (std::int64_t& height : heights)
+            height = uniform(rng, 0, 5);
+        out << (s ? "\n" : "");
+        for (std::int64_t row = 0; row < 7; ++row) {
+            for (const std::int64_t height : heights) {
+                const bool filled = isLock ? row <= height
+                                           : row >= 6 - height;
+                out << (filled ? '#' : '.');
+            }
+            out << '\n';
+        }
+    }
+}
+
+// ============================================================================
+//                                   2025
+// ----------------------------------------------------------------------------
+
+void gen2025_01(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t r = 0; r < size; ++r)
+        out << pick(rng, "LR")
+            << (chance(rng, 0.9) ? uniform(rng, 1, 99) : uniform(rng, 100, 999))
+            << '\n';
+}
+
+void gen2025_02(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t r = 0; r < size; ++r) {
+        std::int64_t magnitude = 1;
+        for (std::int64_t d = uniform(rng, 1, 10); d > 1; --d)
+            magnitude *= 10;
+        const std::int64_t first = uniform(rng, magnitude, 10 * magnitude - 1),
+                           last  = first + uniform(rng, 0, 200'000);
+        out << (r ? "," : "") << first << '-' << last;
+    }
+    out << '\n';
+}
+
+void gen2025_03(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t b = 0; b < size; ++b)
+        out << randomString(rng, 100, "123456789") << '\n';
+}
+
+void gen2025_04(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    for (std::int64_t i = 0; i < size; ++i) {
+        std::string row(size, '.');
+        for (char& cell : row)
+            cell = chance(rng, 0.6) ? '@' : '.';
+        out << row << '\n';
+    }
+}
+
+void gen2025_05(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    constexpr std::int64_t k_MaxId = 560'000'000'000'000;
+    for (std::int64_t r = 0; r < size; ++r) {
+        const std::int64_t first = uniform(rng, 1, k_MaxId);
+        out << first << '-'
+            << first + uniform(rng, 0, 10'000'000'000'000) << '\n';
+    }
+    out << '\n';
+    for (std::int64_t i = 0; i < 5 * size; ++i)
+        out << uniform(rng, 1, k_MaxId) << '\n';
+}
+
+void gen2025_06(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Four rows of operands and a row of operators, one problem per block of
+    // columns, with each problem's operands aligned one way or the other.
+    Rows rows(5);
+    for (std::int64_t p = 0; p < size; ++p) {
+        std::array<std::string, 4> operands;
+        std::size_t width = 0;
+        for (std::string& operand : operands) {
+            operand = std::to_string(uniform(rng, 1, 9)) +
+                      randomString(rng, uniform(rng, 0, 3), "0123456789");
+            width = std::max(width, operand.size());
+        }
+        const bool alignLeft = chance(rng, 0.5);
+        for (int r = 0; r < 4; ++r) {
+            const std::string padding(width - operands[r].size(), ' ');
+            rows[r] += (p ? " " : "");
+            rows[r] += alignLeft ? operands[r] + padding
+                                 : padding + operands[r];
+        }
+        rows[4] += (p ? " " : "");
+        rows[4] += pick(rng, "+*");
+        rows[4] += std::string(width - 1, ' ');
+    }
+    writeRows(out, rows);
+}
+
+void gen2025_07(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    Rows manifold(size + 1, std::string(size, '.'));
+    manifold[0][size / 2] = 'S';
+    for (std::int64_t i = 2; i <= size; i += 2)
+        for (std::int64_t j = 1; j < size - 1; ++j)
+            if (chance(rng, 0.3))
+                manifold[i][j] = '^';
+    writeRows(out, manifold);
+}
+
+void gen2025_08(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // Part 1 connects the 1000 closest pairs, so there must be that many.
+    for (std::int64_t b = 0; b < size; ++b)
+        out << uniform(rng, 0, 99'999) << ',' << uniform(rng, 0, 99'999) << ','
+            << uniform(rng, 0, 99'999) << '\n';
+}
+
+void gen2025_09(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // A rectilinear polygon whose top and bottom edges are staircases over
+    // the same columns, walked clockwise from the bottom left.
+    const std::int64_t numColumns = std::max<std::int64_t>(1, size / 4);
+    std::vector<std::int64_t> xs(numColumns + 1), tops(numColumns),
+                              bottoms(numColumns);
+    std::int64_t x = uniform(rng, 100, 500);
+    for (std::int64_t& column : xs)
+        column = x, x += uniform(rng, 1, 2 * 99'000 / (numColumns + 1));
+    for (std::int64_t c = 0; c < numColumns; ++c) {
+        do {
+            tops[c] = uniform(rng, 50'000, 99'000);
+        } while (c > 0 && tops[c] == tops[c-1]);
+        do {
+            bottoms[c] = uniform(rng, 1'000, 49'000);
+        } while (c > 0 && bottoms[c] == bottoms[c-1]);
+    }
+    for (std::int64_t c = 0; c < numColumns; ++c)
+        out << xs[c]   << ',' << tops[c] << '\n'
+            << xs[c+1] << ',' << tops[c] << '\n';
+    for (std::int64_t c = numColumns - 1; c >= 0; --c)
+        out << xs[c+1] << ',' << bottoms[c] << '\n'
+            << xs[c]   << ',' << bottoms[c] << '\n';
+}
+
+void gen2025_10(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // The target lights and joltages are reachable by construction.
+    for (std::int64_t m = 0; m < size; ++m) {
+        const std::int64_t numLights  = uniform(rng, 4, 10),
+                           numButtons = uniform(rng, 3, 13);
+        std::vector<std::vector<std::int64_t>> buttons(numButtons);
+        std::vector<std::uint8_t> covered(numLights);
+        for (std::int64_t b = 0; b < numButtons; ++b) {
+            for (std::int64_t l = 0; l < numLights; ++l) {
+                if (chance(rng, 0.4) || (b == numButtons - 1 && !covered[l])) {
+                    buttons[b].push_back(l);
+                    covered[l] = 1;
+                }
+            }
+            if (buttons[b].empty())
+                buttons[b].push_back(uniform(rng, 0, numLights - 1));
+        }
+        std::string lights(numLights, '.');
+        std::vector<std::int64_t> joltages(numLights);
+        for (const auto& button : buttons) {
+            const bool toggle = chance(rng, 0.5);
+            const std::int64_t presses = uniform(rng, 0, 20);
+            for (const std::int64_t l : button) {
+                if (toggle)
+                    lights[l] = lights[l] == '.' ? '#' : '.';
+                joltages[l] += presses;
+            }
+        }
+        out << '[' << lights << ']';
+        for (const auto& button : buttons) {
+            out << " (";
+            for (std::size_t i = 0; i < button.size(); ++i)
+                out << (i ? "," : "") << button[i];
+            out << ')';
+        }
+        out << " {";
+        for (std::int64_t l = 0; l < numLights; ++l)
+            out << (l ? "," : "") << joltages[l];
+        out << "}\n";
+    }
+}
+
+void gen2025_11(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // A DAG over devices in topological order: 'svr' first, then 'you',
+    // 'fft', 'dac' and, last, 'out'.  Each device feeds up to three devices
+    // shortly after it, which keeps path counts in range.
+    std::vector<std::string> devices;
+    std::vector<std::int64_t> names(26 * 26 * 26);
+    std::iota(names.begin(), names.end(), 0);
+    std::shuffle(names.begin(), names.end(), rng);
+    for (const std::int64_t name : names) {
+        std::string device = letterName(name, 3);
+        if (device != "svr" && device != "you" && device != "fft" &&
+            device != "dac" && device != "out")
+            devices.push_back(std::move(device));
+        if (std::int64_t(devices.size()) == size - 5)
+            break;
+    }
+    devices.insert(devices.begin(), "svr");
+    devices.insert(devices.begin() + devices.size() / 5, "you");
+    devices.insert(devices.begin() + devices.size() / 3, "fft");
+    devices.insert(devices.begin() + 2 * devices.size() / 3, "dac");
+    devices.push_back("out");
+
+    const std::int64_t numDevices = devices.size();
+    std::vector<std::string> lines;
+    for (std::int64_t d = 0; d + 1 < numDevices; ++d) {
+        const std::int64_t numOutputs = chance(rng, 0.7) ? 1
+                                      : chance(rng, 0.8) ? 2
+                                      :                    3;
+        std::vector<std::int64_t> outputs;
+        for (std::int64_t o = 0; o < numOutputs; ++o) {
+            const std::int64_t next =
+                         std::min(numDevices - 1, d + uniform(rng, 1, 12));
+            if (std::find(outputs.begin(), outputs.end(), next) ==
+                                                               outputs.end())
+                outputs.push_back(next);
+        }
+        std::string line = devices[d] + ':';
+        for (const std::int64_t next : outputs)
+            line += ' ' + devices[next];
+        lines.push_back(std::move(line));
+    }
+    std::shuffle(lines.begin(), lines.end(), rng);
+    writeRows(out, lines);
+}
+
+void gen2025_12(std::ostream& out, std::int64_t size, Rng& rng)
+{
+    // The real input's presents.  Each region either fits its presents in
+    // 3x3 blocks without any interlocking or has fewer cells than they
+    // cover, as in the real input.
+    constexpr std::string_view k_Presents[] = {
+        "###\n..#\n###\n", "##.\n.##\n###\n", "..#\n.##\n###\n",
+        "###\n##.\n##.\n", "###\n.#.\n###\n", ".##\n##.\n#..\n",
+    };
+    constexpr std::int64_t k_NumPresents = std::size(k_Presents);
+    std::array<std::int64_t, k_NumPresents> areas;
+    for (std::int64_t p = 0; p < k_NumPresents; ++p) {
+        out << p << ":\n" << k_Presents[p] << '\n';
+        areas[p] = std::ranges::count(k_Presents[p], '#');
+    }
+
+    for (std::int64_t r = 0; r < size; ++r) {
+        const std::int64_t m = uniform(rng, 35, 50), n = uniform(rng, 35, 50);
+        std::array<std::int64_t, k_NumPresents> counts{};
+        std::int64_t numBlocks = (m / 3) * (n / 3), area = 0;
+        if (chance(rng, 0.5)) {
+            while (numBlocks-- > 0 && !chance(rng, 0.05))
+                ++counts[uniform(rng, 0, k_NumPresents - 1)];
+        }
+        else {
+            while (area <= m * n) {
+                const std::int64_t p = uniform(rng, 0, k_NumPresents - 1);
+                ++counts[p];
+                area += areas[p];
+            }
+        }
+        out << m << 'x' << n << ':';
+        for (const std::int64_t count : counts)
+            out << ' ' << count;
+        out << '\n';
+    }
+}
+
+constexpr Generator k_Generators[] = {
+    { "2024/01", "lines",              1000,    1, 1 << 24, gen2024_01 },
+    { "2024/02", "reports",            1000,    1, 1 << 24, gen2024_02 },
+    { "2024/03", "lines of 3000 bytes",   6,    1, 1 << 16, gen2024_03 },
+    { "2024/04", "grid side",           140,    4,   16384, gen2024_04 },
+    { "2024/05", "updates",             190,    1, 1 << 22, gen2024_05 },
+    { "2024/06", "grid side",           130,    8,    4096, gen2024_06 },
+    { "2024/07", "equations",           850,    1, 1 << 22, gen2024_07 },
+    { "2024/08", "grid side",            50,    4,   16384, gen2024_08 },
+    { "2024/09", "disk map digits",   19999,    1, 1 << 26, gen2024_09 },
+    { "2024/10", "grid side",            45,    4,   16384, gen2024_10 },
+    { "2024/11", "stones",                8,    1, 1 << 22, gen2024_11 },
+    { "2024/12", "grid side",           140,    1,   16384, gen2024_12 },
+    { "2024/13", "claw machines",       320,    1, 1 << 22, gen2024_13 },
+    { "2024/14", "robots",              500,    1, 1 << 22, gen2024_14 },
+    { "2024/15", "grid side",            50,    5,    4096, gen2024_15 },
+    { "2024/16", "grid side",           141,    5,    8191, gen2024_16 },
+    { "2024/17", "octal digits of A",     9,    1,      20, gen2024_17 },
+    { "2024/18", "bytes",              3450, 1025,    5039, gen2024_18 },
+    { "2024/19", "designs",             400,    1, 1 << 22, gen2024_19 },
+    { "2024/20", "grid side",           141,    5,    8191, gen2024_20 },
+    { "2024/21", "codes",                 5,    1, 1 << 22, gen2024_21 },
+    { "2024/22", "buyers",             1714,    1, 1 << 22, gen2024_22 },
+    { "2024/23", "computers",           520,   32,     676, gen2024_23 },
+    { "2024/24", "bits",                 45,   12,      63, gen2024_24 },
+    { "2024/25", "schematics",          500,    1, 1 << 20, gen2024_25 },
+    { "2025/01", "rotations",          4432,    1, 1 << 24, gen2025_01 },
+    { "2025/02", "ranges",               29,    1, 1 << 20, gen2025_02 },
+    { "2025/03", "banks",               200,    1, 1 << 22, gen2025_03 },
+    { "2025/04", "grid side",           140,    1,   16384, gen2025_04 },
+    { "2025/05", "ranges",              183,    1, 1 << 22, gen2025_05 },
+    { "2025/06", "problems",           1000,    1, 1 << 22, gen2025_06 },
+    { "2025/07", "grid side",           141,    3,   16383, gen2025_07 },
+    { "2025/08", "junction boxes",     1000,   50, 1 << 20, gen2025_08 },
+    { "2025/09", "red tiles",           496,    4, 1 << 18, gen2025_09 },
+    { "2025/10", "machines",            199,    1, 1 << 20, gen2025_10 },
+    { "2025/11", "devices",             628,    8,   17000, gen2025_11 },
+    { "2025/12", "regions",            1000,    1, 1 << 22, gen2025_12 },
+};
+
+} // close unnamed namespace
+
+std::span<const Generator> generators()
+{
+    return k_Generators;
+}
+
+const Generator *findGenerator(std::string_view day)
+{
+    const auto it = std::find_if(std::begin(k_Generators),
+                                 std::end(k_Generators),
+                                 [&](const Generator& generator) {
+                                     return generator.d_day == day;
+                                 });
+    return it != std::end(k_Generators) ? it : nullptr;
+}
@@ -0,0 +1,32 @@
+#ifndef INCLUDED_GENERATORS
+#define INCLUDED_GENERATORS
+
+#include <cstdint>
+#include <iosfwd>
+#include <random>
+#include <span>
+#include <string_view>
+
+using Rng = std::mt19937_64;
+
+// Synthetic puzzle-input generator for one day.  'd_generate' writes a valid
+// input of the given size to a stream; what 'size' counts ('d_size') differs
+// per day, and 'd_defaultSize' is about the size of the real input.  Some
+// solutions hardcode properties of the real input (e.g. the 71x71 memory
+// space of 2024/18), which bounds their sizes to '[d_minSize, d_maxSize]'.
+struct Generator {
+    std::string_view d_day;
+    std::string_view d_size;
+    std::int64_t     d_defaultSize;
+    std::int64_t     d_minSize;
+    std::int64_t     d_maxSize;
+    void           (*d_generate)(std::ostream&, std::int64_t, Rng&);
+};
+
+// Every generator, in calendar order.
+std::span<const Generator> generators();
+
+// Return the generator for 'day' (e.g. "2024/06"), or null if there is none.
+const Generator *findGenerator(std::string_view day);
+
+#endif
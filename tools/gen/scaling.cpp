@@ -0,0 +1,534 @@
+// Run every given solution binary against generated inputs of growing size
+// and report how its running time scales, as a tab-separated table:
+//..
+//  $ scaling [-n RUNS] [-f FACTORS] [-j THREADS] [-m MODES] [-t SECONDS]
+//            [-s SEED] BINARY...
+//  solution  year  day  part  size  bytes  threads  mode  phase  runs
+//  min_ns  median_ns  peak_heap_bytes  peak_rss_bytes
+//..
+// 'FACTORS' (by default '0.25,0.5,1,2,4,8') multiply the size of the real
+// input, clamped to the range the day accepts (see 'gen -l').  Besides the
+// phases that 'aoc::run' reports, 'process' is the whole process.  The peak
+// memory columns hold the largest value over the runs, or '-' if the binary
+// does not report it (the heap figure needs 'make release ALLOC_STATS=1').
+// Each binary runs in a scratch directory holding only its generated input.
+// Once a size fails or takes longer than 'SECONDS' (10 by default) the
+// larger ones are skipped.
+//
+// 'THREADS' (e.g. '1,2,4,8') times every size once per number of threads,
+// passed on as '$AOC_THREADS' to the solutions that split up their work (see
+// 'aoc::sharedThreadPool'); without it, 'threads' is '-' and the solutions
+// use every hardware thread.
+//
+// For each solution, stderr gets a log-scale plot of the 'solve' phase (or,
+// without phases, of the process) against input bytes, and the exponent 'k'
+// of the least-squares fit 'time ~ bytes^k', so that e.g. an accidentally
+// quadratic solution stands out with 'k' near 2.  With more than one number
+// of threads, the plot is of the first, and a table of the speedup and
+// parallel efficiency of the others against it follows for every size.
+//
+// 'MODES' (e.g. ',bitplanes') likewise times every size once per mode,
+// passed on as '$AOC_MODE' to the solutions that have more than one way of
+// solving (see 'aoc::mode'); an empty mode runs without '$AOC_MODE', and
+// 'mode' is then '-'.  Without it, every run inherits '$AOC_MODE'.  The plot
+// and the thread table are of the first mode, and with more than one, a
+// table of the speedup of the others against the first follows for every
+// size, with the first number of threads.
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "generators.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Keys of the peak memory figures of a phase line, in column order.
+const std::array<std::string_view, 2> k_MemoryKeys = { "peak_heap_bytes",
+                                                       "peak_rss_bytes" };
+
+struct Solution {
+    std::filesystem::path d_binary;
+    std::string           d_name;
+    std::string           d_inputName;
+    int                   d_year = 0, d_day = 0, d_part = 0;
+};
+
+// Recover the calendar coordinates and the input file name from a path such
+// as '2024/22/day_22-monkey_market-part_2-release'.
+Solution makeSolution(const std::filesystem::path& binary)
+{
+    Solution solution{ std::filesystem::absolute(binary) };
+    std::string name = binary.filename().string();
+    if (name.ends_with("-release"))
+        name.resize(name.size() - std::string_view("-release").size());
+
+    solution.d_name = name;
+    const auto parseInt = [](std::string_view str, int& value) {
+        std::from_chars(str.data(), str.data() + str.size(), value);
+    };
+    parseInt(binary.parent_path().parent_path().filename().string(),
+             solution.d_year);
+    if (name.starts_with("day_"))
+        parseInt(std::string_view(name).substr(4, 2), solution.d_day);
+    if (const auto p = name.rfind("-part_"); p != std::string::npos) {
+        parseInt(std::string_view(name).substr(p + 6), solution.d_part);
+        solution.d_inputName = name.substr(0, p) + "-input.txt";
+    }
+    return solution;
+}
+
+// Run 'solution' once in 'directory' with its output discarded, 'mode' for
+// '$AOC_MODE' (unset if empty) and, unless it is 0, 'numThreads' for
+// '$AOC_THREADS', killing it after 'timeout' seconds.  Append each reported
+// phase's line to
+// 'phaseLines', set 'wallNs' to the process's wall time and 'peakRssBytes' to
+// its largest resident set size, and return the wait status.
+int runOnce(const Solution&              solution,
+            const std::filesystem::path& directory,
+            unsigned                     timeout,
+            int                          numThreads,
+            const std::string&           mode,
+            std::vector<std::string>&    phaseLines,
+            std::int64_t&                wallNs,
+            std::int64_t&                peakRssBytes)
+{
+    const std::filesystem::path logPath = directory / "phases.log";
+    std::filesystem::remove(logPath);
+
+    const auto start = Clock::now();
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        const int devNull = ::open("/dev/null", O_WRONLY);
+        ::dup2(devNull, STDOUT_FILENO);
+        ::dup2(devNull, STDERR_FILENO);
+        ::setenv("AOC_PHASE_LOG", logPath.c_str(), 1);
+        if (numThreads > 0)
+            ::setenv("AOC_THREADS", std::to_string(numThreads).c_str(), 1);
+        if (mode.empty())
+            ::unsetenv("AOC_MODE");
+        else
+            ::setenv("AOC_MODE", mode.c_str(), 1);
+        if (::chdir(directory.c_str()) != 0)
+            ::_exit(127);
+
+        ::alarm(timeout);
+        const std::string binary = solution.d_binary.string();
+        ::execl(binary.c_str(), binary.c_str(), static_cast<char *>(nullptr));
+        ::_exit(127);
+    }
+    int           status = 0;
+    struct rusage usage  = {};
+    ::wait4(pid, &status, 0, &usage);
+    peakRssBytes = std::int64_t(usage.ru_maxrss) * 1024;
+    wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+
+    std::ifstream log(logPath);
+    for (std::string line; std::getline(log, line); )
+        phaseLines.push_back(std::move(line));
+    return status;
+}
+
+// Return the value of 'key' among the tab-separated 'key=value' fields of the
+// phase 'line', or -1 if there is none.
+std::int64_t fieldValue(std::string_view line, std::string_view key)
+{
+    for (auto tab = line.find('\t'); tab != std::string_view::npos;
+                                       tab = line.find('\t', tab + 1)) {
+        const std::string_view field = line.substr(tab + 1);
+        if (field.starts_with(key) &&
+            field.substr(key.size()).starts_with('=')) {
+            std::int64_t value = -1;
+            std::from_chars(field.data() + key.size() + 1,
+                            field.data() + field.size(), value);
+            return value;
+        }
+    }
+    return -1;
+}
+
+struct PhaseSamples {
+    std::string                 d_name;
+    std::vector<std::int64_t>   d_wallNs;
+    std::array<std::int64_t, 2> d_memory = { -1, -1 };  // maxima
+};
+
+struct Point {
+    std::int64_t d_size;
+    std::int64_t d_bytes;
+    std::int64_t d_ns;
+};
+
+// Print 'points' of 'solution' as a plot with a logarithmic time axis, and
+// the exponent of the power law that fits them best.
+void plot(const Solution& solution, const std::vector<Point>& points)
+{
+    if (points.empty())
+        return;
+
+    const auto [lo, hi] = std::minmax_element(
+        points.begin(), points.end(),
+        [](const auto& l, const auto& r) { return l.d_ns < r.d_ns; });
+    const double minNs = std::max<std::int64_t>(1, lo->d_ns),
+                 range = std::log(hi->d_ns / minNs);
+    std::cerr << solution.d_name << ":\n";
+    double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    for (const auto [size, bytes, ns] : points) {
+        const double x = std::log(double(bytes)),
+                     y = std::log(double(std::max<std::int64_t>(1, ns)));
+        sumX += x, sumY += y, sumXX += x * x, sumXY += x * y;
+
+        const int width = range > 0
+                        ? 1 + int(std::lround(
+                              59 * std::log(ns / minNs) / range))
+                        : 1;
+        std::cerr << std::setw(10) << size  << std::setw(12) << bytes << " B"
+                  << std::setw(12) << std::fixed << std::setprecision(3)
+                  << ns / 1e6 << " ms  " << std::string(width, '#') << '\n';
+    }
+    const double n = points.size(), denominator = n * sumXX - sumX * sumX;
+    if (points.size() > 1 && denominator > 0)
+        std::cerr << "  k = " << std::setprecision(2)
+                  << (n * sumXY - sumX * sumY) / denominator << '\n';
+    std::cerr << std::defaultfloat << std::flush;
+}
+
+// Print, for each size in 'sizes' measured with every number of threads in
+// 'threads', how much faster than the first number's 'solve' phase those
+// with the others are ("speedup"), and what fraction of that is of the ideal
+// linear speedup ("efficiency").  'ns[s][t]' is the time of size 's' with
+// 'threads[t]', or missing if that failed.
+void plotThreads(const Solution&                               solution,
+                 const std::vector<int>&                       threads,
+                 const std::vector<std::int64_t>&              sizes,
+                 const std::vector<std::vector<std::int64_t>>& ns)
+{
+    if (threads.size() < 2)
+        return;
+
+    std::cerr << solution.d_name << " threads:\n";
+    for (std::size_t s = 0; s < sizes.size(); ++s) {
+        for (std::size_t t = 0; t < ns[s].size(); ++t) {
+            const double speedup =
+                double(std::max<std::int64_t>(1, ns[s][0])) /
+                double(std::max<std::int64_t>(1, ns[s][t]));
+            std::cerr << std::setw(10) << sizes[s]
+                      << std::setw(6)  << threads[t]
+                      << std::setw(12) << std::fixed << std::setprecision(3)
+                      << ns[s][t] / 1e6 << " ms"
+                      << std::setw(8)  << std::setprecision(2) << speedup
+                      << "x" << std::setw(6) << std::setprecision(0)
+                      << 100 * speedup * threads[0] / threads[t] << "%\n";
+        }
+    }
+    std::cerr << std::defaultfloat << std::flush;
+}
+
+// Print, for each size in 'sizes' measured in every mode in 'modes', how much
+// faster than the first mode's 'solve' phase those in the others are.
+// 'ns[s][m]' is the time of size 's' in 'modes[m]', or missing if that
+// failed.
+void plotModes(const Solution&                               solution,
+               const std::vector<std::string>&               modes,
+               const std::vector<std::int64_t>&              sizes,
+               const std::vector<std::vector<std::int64_t>>& ns)
+{
+    if (modes.size() < 2)
+        return;
+
+    std::cerr << solution.d_name << " modes:\n";
+    for (std::size_t s = 0; s < sizes.size(); ++s) {
+        for (std::size_t m = 0; m < ns[s].size(); ++m) {
+            const double speedup =
+                double(std::max<std::int64_t>(1, ns[s][0])) /
+                double(std::max<std::int64_t>(1, ns[s][m]));
+            std::cerr << std::setw(10) << sizes[s] << "  " << std::left
+                      << std::setw(12) << (modes[m].empty() ? "-" : modes[m])
+                      << std::right
+                      << std::setw(12) << std::fixed << std::setprecision(3)
+                      << ns[s][m] / 1e6 << " ms"
+                      << std::setw(8)  << std::setprecision(2) << speedup
+                      << "x\n";
+        }
+    }
+    std::cerr << std::defaultfloat << std::flush;
+}
+
+// Time 'solution' 'numRuns' times on its input of 'size' and 'bytes' in
+// 'directory', with 'numThreads' and 'mode' as for 'runOnce', and print a
+// table line for each phase.  Return the fastest time of the 'solve' phase
+// (or, without phases, of the process), or -1 if a run failed.
+std::int64_t measure(const Solution&              solution,
+                     const std::filesystem::path& directory,
+                     std::int64_t                 size,
+                     std::int64_t                 bytes,
+                     int                          numThreads,
+                     const std::string&           mode,
+                     int                          numRuns,
+                     unsigned                     timeout)
+{
+    // in first-reported order
+    std::vector<PhaseSamples> phases = { { "process" } };
+    for (int run = 0; run < numRuns; ++run) {
+        std::vector<std::string> lines;
+        std::int64_t             wallNs = 0, peakRssBytes = 0;
+        const int status = runOnce(solution, directory, timeout, numThreads,
+                                   mode, lines, wallNs, peakRssBytes);
+        if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+            std::cerr << solution.d_name << ": size " << size
+                      << (WIFSIGNALED(status) &&
+                          WTERMSIG(status) == SIGALRM ? ": timed out"
+                                                      : ": run failed")
+                      << std::endl;
+            return -1;
+        }
+        phases.front().d_wallNs.push_back(wallNs);
+        phases.front().d_memory[1] = std::max(phases.front().d_memory[1],
+                                              peakRssBytes);
+        for (const std::string_view line : lines) {
+            const auto         tab = line.find('\t');
+            const std::int64_t ns  = fieldValue(line, "wall_ns");
+            if ((tab == std::string_view::npos) || (ns < 0))
+                continue;
+
+            const std::string_view name = line.substr(0, tab);
+            auto it = std::find_if(phases.begin(), phases.end(),
+                                   [&](const auto& p) {
+                                       return p.d_name == name;
+                                   });
+            if (it == phases.end())
+                it = phases.insert(phases.end(), { std::string(name) });
+
+            it->d_wallNs.push_back(ns);
+            for (std::size_t i = 0; i < k_MemoryKeys.size(); ++i)
+                it->d_memory[i] = std::max(it->d_memory[i],
+                                           fieldValue(line, k_MemoryKeys[i]));
+        }
+    }
+
+    for (auto& [name, samples, memory] : phases) {
+        std::sort(samples.begin(), samples.end());
+        std::cout << solution.d_name  << '\t'
+                  << solution.d_year  << '\t'
+                  << solution.d_day   << '\t'
+                  << solution.d_part  << '\t'
+                  << size             << '\t'
+                  << bytes            << '\t';
+        if (numThreads > 0)
+            std::cout << numThreads;
+        else
+            std::cout << '-';
+        std::cout << '\t' << (mode.empty() ? "-" : mode) << '\t'
+                  << name             << '\t'
+                  << samples.size()   << '\t'
+                  << samples.front()  << '\t'
+                  << samples[(samples.size() - 1) / 2];
+        for (const std::int64_t value : memory) {
+            std::cout << '\t';
+            if (value >= 0)
+                std::cout << value;
+            else
+                std::cout << '-';
+        }
+        std::cout << std::endl;
+    }
+    const auto solve = std::find_if(phases.begin(), phases.end(),
+                                    [](const auto& p) {
+                                        return p.d_name == "solve";
+                                    });
+    return (solve != phases.end() ? *solve : phases.front()).d_wallNs.front();
+}
+
+void scale(const Solution&                 solution,
+           const std::vector<double>&      factors,
+           const std::vector<int>&         threads,
+           const std::vector<std::string>& modes,
+           int                             numRuns,
+           unsigned                        timeout,
+           std::uint64_t                   seed)
+{
+    const std::string day = std::to_string(solution.d_year) + '/' +
+                            (solution.d_day < 10 ? "0" : "") +
+                            std::to_string(solution.d_day);
+    const Generator *generator = findGenerator(day);
+    if (!generator || solution.d_inputName.empty()) {
+        std::cerr << solution.d_binary.string() << ": no generator"
+                  << std::endl;
+        return;
+    }
+
+    char scratch[] = "/tmp/aoc-scaling-XXXXXX";
+    if (!::mkdtemp(scratch)) {
+        std::perror("mkdtemp");
+        std::exit(1);
+    }
+    const std::filesystem::path directory = scratch;
+
+    std::vector<Point>                     points;
+    std::vector<std::int64_t>              sizes;
+    std::vector<std::vector<std::int64_t>> threadNs;  // by size, then threads
+    std::vector<std::vector<std::int64_t>> modeNs;    // by size, then modes
+    std::int64_t previousSize = 0;
+    bool         failed       = false;
+    for (const double factor : factors) {
+        const std::int64_t size = std::clamp<std::int64_t>(
+                           std::llround(generator->d_defaultSize * factor),
+                           generator->d_minSize, generator->d_maxSize);
+        if (size == previousSize)
+            continue;
+        previousSize = size;
+
+        const std::filesystem::path input = directory / solution.d_inputName;
+        {
+            std::ofstream stream(input);
+            Rng rng(seed);
+            generator->d_generate(stream, size, rng);
+        }
+        const std::int64_t bytes = std::filesystem::file_size(input);
+
+        sizes.push_back(size);
+        threadNs.emplace_back();
+        modeNs.emplace_back();
+        for (std::size_t m = 0; m < modes.size() && !failed; ++m) {
+            for (const int numThreads : threads) {
+                const std::int64_t ns = measure(solution, directory, size,
+                                                bytes, numThreads, modes[m],
+                                                numRuns, timeout);
+                if (ns < 0) {
+                    failed = true;
+                    break;
+                }
+                if (m == 0) {
+                    if (threadNs.back().empty())
+                        points.push_back({ size, bytes, ns });
+                    threadNs.back().push_back(ns);
+                }
+                if (numThreads == threads.front())
+                    modeNs.back().push_back(ns);
+            }
+        }
+        if (threadNs.back().empty()) {
+            sizes.pop_back();
+            threadNs.pop_back();
+            modeNs.pop_back();
+        }
+        if (failed)
+            break;
+    }
+    std::filesystem::remove_all(directory);
+    plot(solution, points);
+    plotThreads(solution, threads, sizes, threadNs);
+    plotModes(solution, modes, sizes, modeNs);
+}
+
+// Return the positive numbers of the comma-separated 'list', in ascending
+// order.
+template <class NUMBER>
+std::vector<NUMBER> parseList(std::string_view list)
+{
+    std::vector<NUMBER> numbers;
+    while (!list.empty()) {
+        const auto comma = std::min(list.find(','), list.size());
+        NUMBER number = 0;
+        std::from_chars(list.data(), list.data() + comma, number);
+        if (number > 0)
+            numbers.push_back(number);
+        list.remove_prefix(std::min(comma + 1, list.size()));
+    }
+    std::sort(numbers.begin(), numbers.end());
+    return numbers;
+}
+
+// Return the entries of the comma-separated 'list', in order, including
+// empty ones.
+std::vector<std::string> splitList(std::string_view list)
+{
+    std::vector<std::string> entries;
+    for (;;) {
+        const auto comma = std::min(list.find(','), list.size());
+        entries.emplace_back(list.substr(0, comma));
+        if (comma == list.size())
+            return entries;
+        list.remove_prefix(comma + 1);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int                      numRuns = 3;
+    unsigned                 timeout = 10;
+    std::uint64_t            seed    = 0;
+    std::vector<double>      factors = { 0.25, 0.5, 1, 2, 4, 8 };
+    std::vector<int>         threads = { 0 };   // unset '$AOC_THREADS'
+    std::vector<std::string> modes   = { "" };  // unset '$AOC_MODE'
+    std::vector<Solution>    solutions;
+    if (const char *const mode = std::getenv("AOC_MODE"))
+        modes = { mode };
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-n") && (i + 1 < argc)) {
+            numRuns = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-t") && (i + 1 < argc)) {
+            timeout = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-s") && (i + 1 < argc)) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "-f") && (i + 1 < argc)) {
+            factors = parseList<double>(argv[++i]);
+        }
+        else if ((arg == "-j") && (i + 1 < argc)) {
+            threads = parseList<int>(argv[++i]);
+        }
+        else if ((arg == "-m") && (i + 1 < argc)) {
+            modes = splitList(argv[++i]);
+        }
+        else if (arg.starts_with('-')) {
+            solutions.clear();
+            break;
+        }
+        else {
+            solutions.push_back(makeSolution(arg));
+        }
+    }
+    if (solutions.empty() || factors.empty() || threads.empty()) {
+        std::cerr << "usage: " << argv[0] << " [-n RUNS] [-f FACTORS]"
+                     " [-j THREADS] [-m MODES] [-t SECONDS] [-s SEED]"
+                     " BINARY..."
+                  << std::endl;
+        return 2;
+    }
+    std::sort(solutions.begin(), solutions.end(),
+              [](const Solution& lhs, const Solution& rhs) {
+                  return std::tie(lhs.d_year, lhs.d_day, lhs.d_part) <
+                         std::tie(rhs.d_year, rhs.d_day, rhs.d_part);
+              });
+
+    std::cout << "solution\tyear\tday\tpart\tsize\tbytes\tthreads\tmode\tphase"
+                 "\truns\tmin_ns\tmedian_ns\tpeak_heap_bytes\tpeak_rss_bytes"
+              << std::endl;
+    for (const Solution& solution : solutions)
+        scale(solution, factors, threads, modes, numRuns, timeout, seed);
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Ask a running 'daemon' for one answer and print it:
+//..
+//  $ client [-s SOCKET] [-C ROOT] YEAR DAY PART [INPUT]
+//..
+// 'INPUT' is a puzzle input file, or '-' for stdin; by default the day's own
+// '*-input.txt' below 'ROOT' (the repository root by default) is sent.
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <aoc/mapped_file.h>
+
+#include "protocol.h"
+
+#ifndef AOC_ROOT
+#define AOC_ROOT "."
+#endif
+
+int main(int argc, char *argv[])
+{
+    std::string                   socketPath = defaultSocketPath();
+    std::filesystem::path         root       = AOC_ROOT;
+    std::vector<std::string_view> operands;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-s") && (i + 1 < argc)) {
+            socketPath = argv[++i];
+        }
+        else if ((arg == "-C") && (i + 1 < argc)) {
+            root = argv[++i];
+        }
+        else if (arg.starts_with('-') && arg != "-") {
+            operands.clear();
+            break;
+        }
+        else {
+            operands.push_back(arg);
+        }
+    }
+    Request request;
+    if (operands.size() < 3 || operands.size() > 4 ||
+        (request.d_year = std::atoi(operands[0].data())) <= 0 ||
+        (request.d_day  = std::atoi(operands[1].data())) <= 0 ||
+        (request.d_part = std::atoi(operands[2].data())) <= 0) {
+        std::cerr << "usage: " << argv[0]
+                  << " [-s SOCKET] [-C ROOT] YEAR DAY PART [INPUT]"
+                  << std::endl;
+        return 2;
+    }
+
+    if (operands.size() == 4 && operands[3] == "-") {
+        request.d_input.assign(std::istreambuf_iterator<char>(std::cin), {});
+    }
+    else {
+        std::filesystem::path path;
+        if (operands.size() == 4) {
+            path = operands[3];
+        }
+        else {
+            char day[3];
+            std::snprintf(day, sizeof day, "%02d", request.d_day);
+            path = aoc::findInputFile(
+                     "-input.txt", root / std::to_string(request.d_year) / day);
+        }
+        const aoc::MappedFile file(path);
+        request.d_input.assign(file.bytes().begin(), file.bytes().end());
+    }
+
+    const int fd = connectTo(socketPath);
+    if (fd < 0) {
+        std::cerr << "Failed to connect to " << socketPath << std::endl;
+        return 1;
+    }
+    Reader   reader(fd);
+    Response response;
+    if (!writeRequest(fd, request) || !readResponse(reader, response)) {
+        std::cerr << "Connection to " << socketPath << " lost" << std::endl;
+        return 1;
+    }
+    (response.d_ok ? std::cout : std::cerr) << response.d_body << std::endl;
+    return response.d_ok ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+// Serve answers from every solution linked into this binary over a Unix
+// socket, so that repeated queries pay neither process startup nor the
+// construction of tables that solutions build once and keep in statics (e.g.
+// 2024/11's stone magnitudes and 2024/21's keypad costs):
+//..
+//  $ daemon [-s SOCKET] [-C ROOT] [-w]
+//..
+// Each connection is served by its own thread and carries any number of
+// requests (see 'protocol.h'), each answered by running the requested
+// solution's 'main' on the request's bytes as its puzzle input.  With '-w'
+// every solution is first run once on its own input below 'ROOT' (the
+// repository root by default), which builds its tables.  The solutions'
+// checks are turned off (see 'aoc::checksEnabled'); 'tests' runs them.
+//
+// The solutions run in-process unguarded: one that aborts on a malformed
+// input takes the daemon down with it.
+
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/registry.h>
+#include <aoc/run.h>
+
+#include "protocol.h"
+
+#ifndef AOC_ROOT
+#define AOC_ROOT "."
+#endif
+
+using SolutionMap = std::map<std::tuple<int, int, int>, const aoc::Solution *>;
+
+namespace {
+
+std::string s_socketPath;
+
+extern "C" void handleSignal(int signal)
+{
+    ::unlink(s_socketPath.c_str());
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+} // close unnamed namespace
+
+// Run 'solution' on the input this thread's 'aoc::inputFileOverride()' or
+// 'aoc::inputDirectory()' selects, returning its response.
+Response runSolution(const aoc::Solution& solution)
+{
+    std::ostringstream answer;
+    aoc::answerStream() = &answer;
+
+    char  name[] = "daemon";
+    char *argv[] = { name, nullptr };
+    const int status = solution.d_main(1, argv);
+
+    Response response;
+    response.d_ok   = status == 0;
+    response.d_body = response.d_ok ? answer.str()
+                                    : "exit status " + std::to_string(status);
+    while (!response.d_body.empty() && response.d_body.back() == '\n')
+        response.d_body.pop_back();
+    return response;
+}
+
+// Answer the requests on 'fd' until the client hangs up, then close it.
+void serve(int fd, const SolutionMap& solutions)
+{
+    // Each input is handed over in an anonymous file that this connection
+    // rewrites per request, since solutions read their inputs by path.
+    const int input = ::memfd_create("aoc-input", MFD_CLOEXEC);
+    if (input < 0) {
+        std::cerr << "memfd_create failed" << std::endl;
+        ::close(fd);
+        return;
+    }
+    aoc::inputFileOverride() = "/proc/self/fd/" + std::to_string(input);
+
+    Reader  reader(fd);
+    Request request;
+    while (readRequest(reader, request)) {
+        Response response;
+        const auto it = solutions.find({ request.d_year,
+                                         request.d_day,
+                                         request.d_part });
+        if (it == solutions.end()) {
+            response.d_body = "no such solution";
+        }
+        else if (::ftruncate(input, 0) != 0 ||
+                 ::pwrite(input, request.d_input.data(),
+                          request.d_input.size(), 0) !=
+                                         ssize_t(request.d_input.size())) {
+            response.d_body = "failed to stage input";
+        }
+        else {
+            response = runSolution(*it->second);
+        }
+        if (!writeResponse(fd, response))
+            break;
+    }
+    ::close(input);
+    ::close(fd);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string           socketPath = defaultSocketPath();
+    std::filesystem::path root       = AOC_ROOT;
+    bool                  warmUp     = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-s") && (i + 1 < argc)) {
+            socketPath = argv[++i];
+        }
+        else if ((arg == "-C") && (i + 1 < argc)) {
+            root = argv[++i];
+        }
+        else if (arg == "-w") {
+            warmUp = true;
+        }
+        else {
+            std::cerr << "usage: " << argv[0] << " [-s SOCKET] [-C ROOT] [-w]"
+                      << std::endl;
+            return 2;
+        }
+    }
+    root = std::filesystem::absolute(root);
+    aoc::checksEnabled() = false;
+
+    SolutionMap solutions;
+    for (const aoc::Solution& solution : aoc::registry()) {
+        solutions[{ solution.d_year, solution.d_day, solution.d_part }] =
+                                                                    &solution;
+    }
+    if (warmUp) {
+        for (const auto& [key, solution] : solutions) {
+            aoc::inputDirectory() = root / solution->d_directory;
+            const Response response = runSolution(*solution);
+            std::cerr << solution->d_name << ": " << response.d_body
+                      << std::endl;
+        }
+        aoc::inputDirectory().clear();
+    }
+
+    const auto address = socketAddress(socketPath);
+    const int  listener = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (!address || listener < 0) {
+        std::cerr << "Bad socket path " << socketPath << std::endl;
+        return 1;
+    }
+    ::unlink(socketPath.c_str());
+    if (::bind(listener, reinterpret_cast<const sockaddr *>(&*address),
+               sizeof *address) != 0 ||
+        ::listen(listener, SOMAXCONN) != 0) {
+        std::cerr << "Failed to listen on " << socketPath << std::endl;
+        return 1;
+    }
+    s_socketPath = socketPath;
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+    std::cerr << "serving " << solutions.size() << " solutions on "
+              << socketPath << std::endl;
+
+    for (;;) {
+        const int fd = ::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd >= 0)
+            std::thread(serve, fd, std::cref(solutions)).detach();
+    }
+}
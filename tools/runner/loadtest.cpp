@@ -0,0 +1,196 @@
+// Load a running 'daemon' with requests from several connections at once and
+// report its throughput and latency distribution:
+//..
+//  $ loadtest [-s SOCKET] [-C ROOT] [-c CONNECTIONS] [-d SECONDS | -n REQUESTS]
+//             YEAR/DAY/PART[=INPUT]...
+//  requests  errors  wall_ns  requests_per_sec
+//  p50_ns  p90_ns  p99_ns  p999_ns  max_ns
+//..
+// Each connection sends its requests back to back, cycling through the given
+// targets from a different starting point.  A target's input is the file
+// 'INPUT', or by default the day's own '*-input.txt' below 'ROOT' (the
+// repository root by default).  The run lasts 'SECONDS' (5 by default) or
+// until 'REQUESTS' have been answered across all connections.  Latency is
+// measured per request from its first byte sent to its answer's last byte
+// received.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <aoc/mapped_file.h>
+
+#include "protocol.h"
+
+#ifndef AOC_ROOT
+#define AOC_ROOT "."
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+struct Connection {
+    std::vector<std::int64_t> d_latenciesNs;
+    std::int64_t              d_numErrors = 0;
+};
+
+// Return the request for 'target', "YEAR/DAY/PART[=INPUT]", or nothing if
+// it is malformed.
+std::optional<Request> makeRequest(std::string_view             target,
+                                   const std::filesystem::path& root)
+{
+    Request request;
+    std::filesystem::path path;
+    if (const auto equals = target.find('='); equals != target.npos) {
+        path = target.substr(equals + 1);
+        target.remove_suffix(target.size() - equals);
+    }
+    std::string fields(target);
+    std::replace(fields.begin(), fields.end(), '/', ' ');
+    std::int64_t values[3];
+    if (!parseFields(fields, values))
+        return std::nullopt;
+    request.d_year = int(values[0]);
+    request.d_day  = int(values[1]);
+    request.d_part = int(values[2]);
+
+    if (path.empty()) {
+        char day[3];
+        std::snprintf(day, sizeof day, "%02d", request.d_day);
+        path = aoc::findInputFile(
+                     "-input.txt", root / std::to_string(request.d_year) / day);
+    }
+    const aoc::MappedFile file(path);
+    request.d_input.assign(file.bytes().begin(), file.bytes().end());
+    return request;
+}
+
+// Return the 'q'-quantile of the sorted 'values'.
+std::int64_t quantile(const std::vector<std::int64_t>& values, double q)
+{
+    if (values.empty())
+        return 0;
+    return values[std::min(values.size() - 1,
+                           std::size_t(q * double(values.size())))];
+}
+
+int main(int argc, char *argv[])
+{
+    std::string           socketPath     = defaultSocketPath();
+    std::filesystem::path root           = AOC_ROOT;
+    int                   numConnections = 1;
+    double                seconds        = 5;
+    std::int64_t          maxRequests    = 0;
+    std::vector<Request>  requests;
+    bool                  usage          = false;
+    for (int i = 1; i < argc && !usage; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-s") && (i + 1 < argc)) {
+            socketPath = argv[++i];
+        }
+        else if ((arg == "-C") && (i + 1 < argc)) {
+            root = argv[++i];
+        }
+        else if ((arg == "-c") && (i + 1 < argc)) {
+            numConnections = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-d") && (i + 1 < argc)) {
+            seconds = std::atof(argv[++i]);
+        }
+        else if ((arg == "-n") && (i + 1 < argc)) {
+            maxRequests = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg.starts_with('-')) {
+            usage = true;
+        }
+        else if (auto request = makeRequest(arg, root)) {
+            requests.push_back(std::move(*request));
+        }
+        else {
+            usage = true;
+        }
+    }
+    if (usage || requests.empty()) {
+        std::cerr << "usage: " << argv[0] << " [-s SOCKET] [-C ROOT]"
+                     " [-c CONNECTIONS] [-d SECONDS | -n REQUESTS]"
+                     " YEAR/DAY/PART[=INPUT]..." << std::endl;
+        return 2;
+    }
+
+    std::vector<Connection>   connections(numConnections);
+    std::atomic<std::int64_t> numIssued = 0;
+    std::atomic<bool>         failed    = false;
+    const auto start    = Clock::now();
+    const auto deadline = start + std::chrono::duration_cast<Clock::duration>(
+                                      std::chrono::duration<double>(seconds));
+    {
+        std::vector<std::jthread> threads;
+        for (int c = 0; c < numConnections; ++c) {
+            threads.emplace_back([&, c] {
+                Connection& connection = connections[c];
+                const int fd = connectTo(socketPath);
+                if (fd < 0) {
+                    failed = true;
+                    return;
+                }
+                Reader   reader(fd);
+                Response response;
+                for (std::size_t r = c; ; ++r) {
+                    if (maxRequests ? numIssued++ >= maxRequests
+                                    : Clock::now() >= deadline)
+                        break;
+                    const auto sent = Clock::now();
+                    if (!writeRequest(fd, requests[r % requests.size()]) ||
+                        !readResponse(reader, response)) {
+                        failed = true;
+                        break;
+                    }
+                    connection.d_latenciesNs.push_back(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  Clock::now() - sent).count());
+                    connection.d_numErrors += !response.d_ok;
+                }
+                ::close(fd);
+            });
+        }
+    }
+    const std::int64_t wallNs =
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+    if (failed)
+        std::cerr << "Connection to " << socketPath << " failed" << std::endl;
+
+    std::vector<std::int64_t> latenciesNs;
+    std::int64_t              numErrors = 0;
+    for (const Connection& connection : connections) {
+        latenciesNs.insert(latenciesNs.end(),
+                           connection.d_latenciesNs.begin(),
+                           connection.d_latenciesNs.end());
+        numErrors += connection.d_numErrors;
+    }
+    std::sort(latenciesNs.begin(), latenciesNs.end());
+
+    std::cout << "requests\terrors\twall_ns\trequests_per_sec"
+                 "\tp50_ns\tp90_ns\tp99_ns\tp999_ns\tmax_ns" << std::endl;
+    std::cout << latenciesNs.size()                        << '\t'
+              << numErrors                                 << '\t'
+              << wallNs                                    << '\t'
+              << (wallNs ? latenciesNs.size() * 1e9 / double(wallNs) : 0.0)
+              << '\t'
+              << quantile(latenciesNs, 0.5)                << '\t'
+              << quantile(latenciesNs, 0.9)                << '\t'
+              << quantile(latenciesNs, 0.99)               << '\t'
+              << quantile(latenciesNs, 0.999)              << '\t'
+              << (latenciesNs.empty() ? 0 : latenciesNs.back())
+              << std::endl;
+    return failed || numErrors ? 1 : 0;
+}
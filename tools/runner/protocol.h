@@ -0,0 +1,202 @@
+#ifndef INCLUDED_PROTOCOL
+#define INCLUDED_PROTOCOL
+
+// Wire format between 'daemon' and its clients over a Unix stream socket.  A
+// connection carries any number of request/response pairs in turn:
+//..
+//  request:  "YEAR DAY PART SIZE\n" followed by SIZE bytes of puzzle input
+//  response: "ok SIZE\n" or "error SIZE\n" followed by SIZE bytes of answer
+//            or error message
+//..
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+struct Request {
+    int         d_year = 0, d_day = 0, d_part = 0;
+    std::string d_input;
+};
+
+struct Response {
+    bool        d_ok = false;
+    std::string d_body;
+};
+
+// Return the socket path: '$AOC_SOCKET', or one per user in '/tmp'.
+inline std::string defaultSocketPath()
+{
+    if (const char *const path = std::getenv("AOC_SOCKET"))
+        return path;
+    return "/tmp/aoc-" + std::to_string(::getuid()) + ".sock";
+}
+
+// Return 'sockaddr_un' for 'path', or nothing if it is too long.
+inline std::optional<sockaddr_un> socketAddress(const std::string& path)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof address.sun_path)
+        return std::nullopt;
+    path.copy(address.sun_path, path.size());
+    return address;
+}
+
+// Return a socket connected to the daemon at 'path', or -1.
+inline int connectTo(const std::string& path)
+{
+    const auto address = socketAddress(path);
+    const int  fd      = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (!address || fd < 0 ||
+        ::connect(fd, reinterpret_cast<const sockaddr *>(&*address),
+                  sizeof *address) != 0) {
+        if (fd >= 0)
+            ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+inline bool writeAll(int fd, std::string_view bytes)
+{
+    while (!bytes.empty()) {
+        const ssize_t n = ::send(fd, bytes.data(), bytes.size(), MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        bytes.remove_prefix(n);
+    }
+    return true;
+}
+
+// Buffered reads from a socket.
+class Reader {
+  public:
+    explicit Reader(int fd)
+        : d_fd(fd)
+    {
+    }
+
+    // Read through the next '\n' and return the line without it, or nothing
+    // at end of stream.
+    std::optional<std::string> readLine()
+    {
+        for (std::size_t scanned = 0; ; ) {
+            if (const auto eol = d_buffer.find('\n', scanned);
+                eol != std::string::npos) {
+                std::string line = d_buffer.substr(0, eol);
+                d_buffer.erase(0, eol + 1);
+                return line;
+            }
+            scanned = d_buffer.size();
+            if (!fill())
+                return std::nullopt;
+        }
+    }
+
+    // Read exactly 'size' bytes into 'bytes', returning false at end of
+    // stream.
+    bool readExactly(std::size_t size, std::string& bytes)
+    {
+        while (d_buffer.size() < size) {
+            if (!fill())
+                return false;
+        }
+        bytes.assign(d_buffer, 0, size);
+        d_buffer.erase(0, size);
+        return true;
+    }
+
+  private:
+    bool fill()
+    {
+        char buffer[1 << 16];
+        for (;;) {
+            const ssize_t n = ::read(d_fd, buffer, sizeof buffer);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            d_buffer.append(buffer, n);
+            return true;
+        }
+    }
+
+    int         d_fd;
+    std::string d_buffer;
+};
+
+// Parse the space-separated integers of 'line' into 'values', returning
+// whether there were exactly as many.
+template <std::size_t N>
+bool parseFields(std::string_view line, std::int64_t (&values)[N])
+{
+    const char *p = line.data(), *const end = p + line.size();
+    for (std::int64_t& value : values) {
+        while (p != end && *p == ' ')
+            ++p;
+        const auto [next, error] = std::from_chars(p, end, value);
+        if (error != std::errc())
+            return false;
+        p = next;
+    }
+    return p == end;
+}
+
+inline bool writeRequest(int fd, const Request& request)
+{
+    return writeAll(fd, std::to_string(request.d_year) + ' ' +
+                        std::to_string(request.d_day) + ' ' +
+                        std::to_string(request.d_part) + ' ' +
+                        std::to_string(request.d_input.size()) + '\n') &&
+           writeAll(fd, request.d_input);
+}
+
+// Read the next request into 'request', returning false at end of stream or
+// on a malformed header.
+inline bool readRequest(Reader& reader, Request& request)
+{
+    const std::optional<std::string> header = reader.readLine();
+    std::int64_t fields[4];
+    if (!header || !parseFields(*header, fields) || fields[3] < 0)
+        return false;
+    request.d_year = int(fields[0]);
+    request.d_day  = int(fields[1]);
+    request.d_part = int(fields[2]);
+    return reader.readExactly(fields[3], request.d_input);
+}
+
+inline bool writeResponse(int fd, const Response& response)
+{
+    return writeAll(fd, (response.d_ok ? "ok " : "error ") +
+                        std::to_string(response.d_body.size()) + '\n') &&
+           writeAll(fd, response.d_body);
+}
+
+inline bool readResponse(Reader& reader, Response& response)
+{
+    const std::optional<std::string> header = reader.readLine();
+    if (!header)
+        return false;
+
+    const auto space = header->find(' ');
+    std::int64_t size[1];
+    if (space == std::string::npos ||
+        !parseFields(std::string_view(*header).substr(space + 1), size) ||
+        size[0] < 0)
+        return false;
+    response.d_ok = header->substr(0, space) == "ok";
+    return reader.readExactly(size[0], response.d_body);
+}
+
+#endif
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Usage: register.sh SOURCE
+#
+# Print a translation unit that compiles the day solution SOURCE (e.g.
+# '2024/01/day_01-historian_hysteria-part_1.cpp', relative to the repository
+# root) inside its own namespace and registers its 'main' (and 'runTests', if it
+# defines one) with 'aoc::registry()'.
+# The solution's own '#include <...>' lines are hoisted to global scope first so
+# that, when repeated inside the namespace, their include guards skip them.
+# Run from this directory; the output is compiled with '-iquote ../..'.
+
+src=$1
+dir=$(dirname "$src")
+day=$(basename "$dir")
+year=$(basename "$(dirname "$dir")")
+name=$(basename "$src" .cpp)
+part=${name##*-part_}
+ns=aoc_${year}_${day}_${part}
+if grep -q '^void runTests()' "../../$src"; then
+    tests="&$ns::runTests"
+else
+    tests=nullptr
+fi
+
+echo "// Generated from $src by register.sh -- do not edit."
+grep '^#include <' "../../$src"
+echo '#include <aoc/registry.h>'
+echo
+echo "namespace $ns {"
+echo "#include \"$src\""
+echo "} // close namespace $ns"
+echo
+echo "static const aoc::Registration s_registration({"
+echo "    $year, ${day#0}, $part, \"$name\", \"$dir\", &$ns::main, $tests });"
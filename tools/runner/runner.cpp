@@ -0,0 +1,198 @@
+// Run every solution linked into this binary concurrently on a thread pool and
+// print their answers in calendar order as a tab-separated table:
+//..
+//  $ runner [-j THREADS] [-n ROUNDS] [-c COSTS] [-C ROOT] [FILTER...]
+//  solution    year  day  part  status  wall_ns  answer
+//..
+// Solutions are scheduled longest-job-first.  Their expected costs come from
+// 'COSTS', a table previously written by 'bench' (the sum of the median phase
+// times of each solution); solutions missing from it are assumed to be the most
+// expensive.  Each solution reads its inputs from its directory below 'ROOT'
+// (the repository root by default).  A 'FILTER' such as '2024' or '2025/10'
+// restricts the run to the solutions whose directory starts with it.  The
+// solutions' checks are turned off (see 'aoc::checksEnabled'); 'tests' runs
+// them.
+//
+// With '-n ROUNDS' the whole calendar is run that many times back to back and
+// the table reports the last round.  After each round one throughput line goes
+// to stderr: the round's wall time, the sum of the individual solutions' wall
+// times, and their ratio.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/registry.h>
+#include <aoc/run.h>
+#include <aoc/thread_pool.h>
+
+#ifndef AOC_ROOT
+#define AOC_ROOT "."
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+struct Job {
+    const aoc::Solution *d_solution = nullptr;
+    std::int64_t         d_costNs   = std::numeric_limits<std::int64_t>::max();
+    int                  d_status   = 0;
+    std::int64_t         d_wallNs   = 0;
+    std::string          d_answer;
+};
+
+// Return the expected cost of each solution in the 'bench' table at 'path',
+// keyed by '(year, day, part)'.
+std::map<std::tuple<int, int, int>, std::int64_t> readCosts(
+                                            const std::filesystem::path& path)
+{
+    std::map<std::tuple<int, int, int>, std::int64_t> costs;
+    std::ifstream table(path);
+    if (!table) {
+        std::cerr << "Failed to open " << path << std::endl;
+        std::exit(2);
+    }
+    for (std::string line; std::getline(table, line); ) {
+        std::istringstream fields(line);
+        std::string  solution, phase;
+        int          year, day, part, runs;
+        std::int64_t minNs, medianNs;
+        if (fields >> solution >> year >> day >> part >> phase >> runs
+                   >> minNs >> medianNs)
+            costs[{ year, day, part }] += medianNs;
+    }
+    return costs;
+}
+
+void runJob(Job& job, const std::filesystem::path& root)
+{
+    std::ostringstream answer;
+    aoc::inputDirectory() = root / job.d_solution->d_directory;
+    aoc::answerStream()   = &answer;
+
+    // No operands: the solution solves its own input, not a batch.
+    char  name[]  = "runner";
+    char *argv[]  = { name, nullptr };
+    const auto start = Clock::now();
+    job.d_status = job.d_solution->d_main(1, argv);
+    job.d_wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+
+    job.d_answer = answer.str();
+    while (!job.d_answer.empty() && job.d_answer.back() == '\n')
+        job.d_answer.pop_back();
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t                   numThreads = std::thread::hardware_concurrency();
+    int                           numRounds  = 1;
+    std::filesystem::path         root       = AOC_ROOT;
+    std::filesystem::path         costsPath;
+    std::vector<std::string_view> filters;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-j") && (i + 1 < argc)) {
+            numThreads = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-n") && (i + 1 < argc)) {
+            numRounds = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-c") && (i + 1 < argc)) {
+            costsPath = argv[++i];
+        }
+        else if ((arg == "-C") && (i + 1 < argc)) {
+            root = argv[++i];
+        }
+        else if (arg.starts_with('-')) {
+            std::cerr << "usage: " << argv[0] << " [-j THREADS] [-n ROUNDS]"
+                         " [-c COSTS] [-C ROOT] [FILTER...]" << std::endl;
+            return 2;
+        }
+        else {
+            filters.push_back(arg);
+        }
+    }
+    root = std::filesystem::absolute(root);
+    aoc::checksEnabled() = false;
+
+    const auto costs = costsPath.empty() ? decltype(readCosts({})){}
+                                         : readCosts(costsPath);
+    std::vector<Job> jobs;
+    for (const aoc::Solution& solution : aoc::registry()) {
+        if (!filters.empty() &&
+            std::none_of(filters.begin(), filters.end(), [&](auto filter) {
+                return solution.d_directory.starts_with(filter);
+            }))
+            continue;
+
+        Job& job = jobs.emplace_back();
+        job.d_solution = &solution;
+        const auto it = costs.find({ solution.d_year,
+                                     solution.d_day,
+                                     solution.d_part });
+        if (it != costs.end())
+            job.d_costNs = it->second;
+    }
+    std::stable_sort(jobs.begin(), jobs.end(),
+                     [](const Job& lhs, const Job& rhs) {
+                         return lhs.d_costNs > rhs.d_costNs;
+                     });
+
+    aoc::ThreadPool pool(numThreads);
+    for (int round = 0; round < numRounds; ++round) {
+        const auto start = Clock::now();
+        for (Job& job : jobs)
+            pool.submit([&job, &root] { runJob(job, root); });
+        pool.wait();
+        const std::int64_t wallNs =
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+
+        std::int64_t sumNs = 0;
+        for (const Job& job : jobs)
+            sumNs += job.d_wallNs;
+        std::cerr << "round "        << round + 1
+                  << ": solutions="  << jobs.size()
+                  << " threads="     << pool.size()
+                  << " wall_ns="     << wallNs
+                  << " sum_ns="      << sumNs
+                  << " speedup="     << (wallNs ? double(sumNs) / wallNs : 0.0)
+                  << std::endl;
+    }
+
+    std::sort(jobs.begin(), jobs.end(), [](const Job& lhs, const Job& rhs) {
+        const aoc::Solution& l = *lhs.d_solution;
+        const aoc::Solution& r = *rhs.d_solution;
+        return std::tie(l.d_year, l.d_day, l.d_part) <
+               std::tie(r.d_year, r.d_day, r.d_part);
+    });
+    std::cout << "solution\tyear\tday\tpart\tstatus\twall_ns\tanswer"
+              << std::endl;
+    int status = 0;
+    for (const Job& job : jobs) {
+        const aoc::Solution& solution = *job.d_solution;
+        std::cout << solution.d_name << '\t'
+                  << solution.d_year << '\t'
+                  << solution.d_day  << '\t'
+                  << solution.d_part << '\t'
+                  << job.d_status    << '\t'
+                  << job.d_wallNs    << '\t'
+                  << job.d_answer    << std::endl;
+        status = std::max(status, job.d_status);
+    }
+    return status;
+}
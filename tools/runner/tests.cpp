@@ -0,0 +1,106 @@
+// Run the checks of every solution linked into this binary at once, spread
+// over a thread pool, and report how long each took as a tab-separated table:
+//..
+//  $ tests [-j THREADS] [-C ROOT] [FILTER...]
+//  solution    line  status  wall_ns
+//..
+// Each solution's 'runTests()' registers its checks (see <aoc/checks.h>)
+// with its directory below 'ROOT' (the repository root by default) as the
+// input directory, and all of them then run concurrently.  Once one fails,
+// checks not yet started are skipped and reported as such; failures are
+// printed on stderr, followed by one summary line: the number of checks, of
+// failures, the wall time, and the sum of the checks' own times.  A 'FILTER'
+// restricts the run as for 'runner'.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <aoc/checks.h>
+#include <aoc/mapped_file.h>
+#include <aoc/registry.h>
+#include <aoc/thread_pool.h>
+
+#ifndef AOC_ROOT
+#define AOC_ROOT "."
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char *argv[])
+{
+    std::size_t                   numThreads = std::thread::hardware_concurrency();
+    std::filesystem::path         root       = AOC_ROOT;
+    std::vector<std::string_view> filters;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-j") && (i + 1 < argc)) {
+            numThreads = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-C") && (i + 1 < argc)) {
+            root = argv[++i];
+        }
+        else if (arg.starts_with('-')) {
+            std::cerr << "usage: " << argv[0] << " [-j THREADS] [-C ROOT]"
+                         " [FILTER...]" << std::endl;
+            return 2;
+        }
+        else {
+            filters.push_back(arg);
+        }
+    }
+    root = std::filesystem::absolute(root);
+
+    std::vector<aoc::Check> checks;
+    for (const aoc::Solution& solution : aoc::registry()) {
+        if (!solution.d_runTests ||
+            (!filters.empty() &&
+             std::none_of(filters.begin(), filters.end(), [&](auto filter) {
+                 return solution.d_directory.starts_with(filter);
+             })))
+            continue;
+
+        aoc::inputDirectory() = root / solution.d_directory;
+        solution.d_runTests();
+        for (aoc::Check& check : std::exchange(aoc::pendingChecks(), {}))
+            checks.push_back(std::move(check));
+    }
+    aoc::inputDirectory().clear();
+
+    aoc::ThreadPool                     pool(numThreads);
+    const auto                          start   = Clock::now();
+    const std::vector<aoc::CheckResult> results = aoc::runChecks(checks, pool);
+    const std::int64_t wallNs =
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+
+    static const char *const k_StatusNames[] = { "passed", "failed", "skipped" };
+    std::cout << "solution\tline\tstatus\twall_ns" << std::endl;
+    std::int64_t sumNs       = 0;
+    std::size_t  numFailures = 0;
+    for (std::size_t i = 0; i < checks.size(); ++i) {
+        std::cout << checks[i].d_suite                  << '\t'
+                  << checks[i].d_line                   << '\t'
+                  << k_StatusNames[results[i].d_status] << '\t'
+                  << results[i].d_wallNs                << std::endl;
+        sumNs       += results[i].d_wallNs;
+        numFailures += results[i].d_status == aoc::CheckResult::e_FAILED;
+    }
+    aoc::reportChecks(checks, results);
+    std::cerr << "checks="    << checks.size()
+              << " failures=" << numFailures
+              << " threads="  << pool.size()
+              << " wall_ns="  << wallNs
+              << " sum_ns="   << sumNs
+              << " speedup="  << (wallNs ? double(sumNs) / wallNs : 0.0)
+              << std::endl;
+    return numFailures ? 1 : 0;
+}
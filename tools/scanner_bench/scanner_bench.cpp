@@ -0,0 +1,271 @@
+// Compare the 'std::regex' parsers that 2024/03, 2024/13 and 2024/14 used to
+// have with their 'aoc::Scanner' replacements on large generated inputs, and
+// report throughput as a tab-separated table:
+//..
+//  $ scanner_bench [-m MEGABYTES] [-r RUNS]
+//  case     bytes      parser   min_ns  mb_per_s  checksum
+//..
+// Each case's input is about 'MEGABYTES' (256 by default) of text in that
+// day's format, generated from a fixed seed.  Both parsers of a case must
+// agree on the checksum; a mismatch is reported on stderr and fails the run.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <spanstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <aoc/scanner.h>
+
+using Clock = std::chrono::steady_clock;
+
+// Corrupted memory as in 2024/03: mostly noise drawn from the characters of
+// the instructions, with valid 'mul', 'do' and 'don't' instructions mixed in.
+std::string makeMemory(std::size_t size, std::mt19937_64& rng)
+{
+    constexpr std::string_view k_Noise = "mul(,)don't'0123456789 []{}!@#%^&*";
+    std::uniform_int_distribution<int> pick(0, k_Noise.size() - 1),
+                                       operand(0, 999),
+                                       kind(0, 15);
+    std::string memory;
+    memory.reserve(size + 32);
+    while (memory.size() < size) {
+        switch (kind(rng)) {
+          case 0:
+            memory += "mul(" + std::to_string(operand(rng)) + ',' +
+                      std::to_string(operand(rng)) + ')';
+            break;
+          case 1:
+            memory += "do()";
+            break;
+          case 2:
+            memory += "don't()";
+            break;
+          default:
+            memory += k_Noise[pick(rng)];
+        }
+    }
+    return memory;
+}
+
+// Claw machines as in 2024/13.
+std::string makeMachines(std::size_t size, std::mt19937_64& rng)
+{
+    std::uniform_int_distribution<int> button(1, 99), prize(100, 99999);
+    std::string machines;
+    machines.reserve(size + 128);
+    while (machines.size() < size) {
+        if (!machines.empty())
+            machines += '\n';
+        machines += "Button A: X+" + std::to_string(button(rng)) +
+                    ", Y+" + std::to_string(button(rng)) + '\n';
+        machines += "Button B: X+" + std::to_string(button(rng)) +
+                    ", Y+" + std::to_string(button(rng)) + '\n';
+        machines += "Prize: X=" + std::to_string(prize(rng)) +
+                    ", Y=" + std::to_string(prize(rng)) + '\n';
+    }
+    return machines;
+}
+
+// Robots as in 2024/14.
+std::string makeRobots(std::size_t size, std::mt19937_64& rng)
+{
+    std::uniform_int_distribution<int> x(0, 100), y(0, 102), v(-99, 99);
+    std::string robots;
+    robots.reserve(size + 32);
+    while (robots.size() < size) {
+        robots += "p="  + std::to_string(x(rng)) + ',' +
+                  std::to_string(y(rng)) +
+                  " v=" + std::to_string(v(rng)) + ',' +
+                  std::to_string(v(rng)) + '\n';
+    }
+    return robots;
+}
+
+std::uint64_t memoryRegex(std::string_view input)
+{
+    const std::regex matcher(
+                   "mul\\(([0-9]{1,3}),([0-9]{1,3})\\)|do\\(\\)|don't\\(\\)");
+    std::uint64_t total = 0;
+    bool enabled = true;
+    for (std::cregex_iterator m(input.data(), input.data() + input.size(),
+                                matcher), mEnd; m != mEnd; ++m) {
+        const auto matchStr = m->str();
+        if (matchStr == "do()")
+            enabled = true;
+        else if (matchStr == "don't()")
+            enabled = false;
+        else if (enabled)
+            total += std::stoull((*m)[1]) * std::stoull((*m)[2]);
+    }
+    return total;
+}
+
+std::uint64_t memoryScanner(std::string_view input)
+{
+    std::uint64_t total = 0;
+    bool enabled = true;
+    for (aoc::Scanner scanner(input); scanner.skipToAny("md"); ) {
+        aoc::Scanner attempt = scanner;
+        std::uint64_t x, y;
+        if (scanner.consume("do()")) {
+            enabled = true;
+        }
+        else if (scanner.consume("don't()")) {
+            enabled = false;
+        }
+        else if (attempt.consume("mul(") &&
+                 attempt.readInt(x, 3) && attempt.consume(',') &&
+                 attempt.readInt(y, 3) && attempt.consume(')')) {
+            total += enabled ? x * y : 0;
+            scanner = attempt;
+        }
+        else {
+            scanner.advance();
+        }
+    }
+    return total;
+}
+
+std::uint64_t machinesRegex(std::string_view input)
+{
+    const std::regex buttonMatcher("^Button ([AB]): X\\+(\\d+), Y\\+(\\d+)$"),
+                     prizeMatcher( "^Prize: X=(\\d+), Y=(\\d+)$");
+    std::ispanstream stream(input);
+    std::uint64_t total = 0;
+    for (std::string line; std::getline(stream, line); ) {
+        std::smatch match;
+        if (std::regex_search(line, match, buttonMatcher))
+            total += std::stoll(match[2]) + std::stoll(match[3]);
+        else if (std::regex_search(line, match, prizeMatcher))
+            total += std::stoll(match[1]) + std::stoll(match[2]);
+    }
+    return total;
+}
+
+std::uint64_t machinesScanner(std::string_view input)
+{
+    std::uint64_t total = 0;
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); scanner.skipLine()) {
+        std::int64_t x, y;
+        if ((scanner.consume("Button A: X+") ||
+             scanner.consume("Button B: X+")) &&
+            scanner.readInt(x) && scanner.consume(", Y+") &&
+            scanner.readInt(y))
+            total += x + y;
+        else if (scanner.consume("Prize: X=") && scanner.readInt(x) &&
+                 scanner.consume(", Y=") && scanner.readInt(y))
+            total += x + y;
+    }
+    return total;
+}
+
+std::uint64_t robotsRegex(std::string_view input)
+{
+    const std::regex robotMatcher("^p=([^,]+),([^ ]+) v=([^,]+),(.+)$");
+    std::ispanstream stream(input);
+    std::uint64_t total = 0;
+    for (std::string line; std::getline(stream, line); ) {
+        std::smatch match;
+        if (std::regex_search(line, match, robotMatcher))
+            total += std::stoll(match[1]) + std::stoll(match[2]) +
+                     std::stoll(match[3]) + std::stoll(match[4]);
+    }
+    return total;
+}
+
+std::uint64_t robotsScanner(std::string_view input)
+{
+    std::uint64_t total = 0;
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); scanner.skipLine()) {
+        std::int64_t px, py, vx, vy;
+        if (scanner.consume("p=")  && scanner.readInt(px) &&
+            scanner.consume(',')   && scanner.readInt(py) &&
+            scanner.consume(" v=") && scanner.readInt(vx) &&
+            scanner.consume(',')   && scanner.readInt(vy))
+            total += px + py + vx + vy;
+    }
+    return total;
+}
+
+using Parser    = std::uint64_t (*)(std::string_view);
+using Generator = std::string   (*)(std::size_t, std::mt19937_64&);
+
+struct Case {
+    std::string_view d_name;
+    Generator        d_generate;
+    Parser           d_regex;
+    Parser           d_scanner;
+};
+
+// Run 'parse' on 'input' 'numRuns' times and print its fastest run.  Return
+// its checksum.
+std::uint64_t time(std::string_view name,
+                   std::string_view parser,
+                   Parser           parse,
+                   std::string_view input,
+                   int              numRuns)
+{
+    std::int64_t  minNs    = 0;
+    std::uint64_t checksum = 0;
+    for (int run = 0; run < numRuns; ++run) {
+        const auto start = Clock::now();
+        checksum = parse(input);
+        const std::int64_t ns =
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+        minNs = run ? std::min(minNs, ns) : ns;
+    }
+    std::cout << name         << '\t'
+              << input.size() << '\t'
+              << parser       << '\t'
+              << minNs        << '\t'
+              << (minNs ? input.size() * 1e3 / minNs : 0.0) << '\t'
+              << checksum     << std::endl;
+    return checksum;
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t megabytes = 256;
+    int         numRuns   = 1;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-m") && (i + 1 < argc)) {
+            megabytes = std::max(1, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-r") && (i + 1 < argc)) {
+            numRuns = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::cerr << "usage: " << argv[0] << " [-m MEGABYTES] [-r RUNS]"
+                      << std::endl;
+            return 2;
+        }
+    }
+
+    const Case cases[] = {
+        { "2024/03", makeMemory,   memoryRegex,   memoryScanner   },
+        { "2024/13", makeMachines, machinesRegex, machinesScanner },
+        { "2024/14", makeRobots,   robotsRegex,   robotsScanner   },
+    };
+    std::cout << "case\tbytes\tparser\tmin_ns\tmb_per_s\tchecksum"
+              << std::endl;
+    int status = 0;
+    for (const Case& c : cases) {
+        std::mt19937_64 rng(2024);
+        const std::string input = c.d_generate(megabytes << 20, rng);
+        if (time(c.d_name, "regex",   c.d_regex,   input, numRuns) !=
+            time(c.d_name, "scanner", c.d_scanner, input, numRuns)) {
+            std::cerr << c.d_name << ": checksum mismatch" << std::endl;
+            status = 1;
+        }
+    }
+    return status;
+}
@@ -0,0 +1,264 @@
+// Compare the kernels that 2024/01 used to have (parsing with
+// 'std::from_chars', 'std::sort', and an 'std::unordered_map' of counts) with
+// their replacements ('aoc::Scanner', 'aoc::radixSort', and counting by value
+// or merge-joining the sorted lists) on a large generated input, and report
+// throughput as a tab-separated table:
+//..
+//  $ sort_bench [-n ROWS] [-r RUNS]
+//  stage       rows  bytes  kernel      min_ns  mb_per_s  checksum
+//..
+// The input has 'ROWS' (2^24 by default; 10^8 takes about 1.4 GB) lines of
+// two five-digit location IDs, half of the right ones drawn from the left
+// list, generated from a fixed seed as by 'gen 2024/01'.  Throughput is in
+// megabytes of that text per second, whichever stage is timed.  The kernels
+// of a stage must agree on the checksum; a mismatch is reported on stderr
+// and fails the run.
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <aoc/radix_sort.h>
+#include <aoc/scanner.h>
+
+using Clock = std::chrono::steady_clock;
+
+typedef std::pair<std::vector<std::uint32_t>, std::vector<std::uint32_t>> Lists;
+
+std::string makeLists(std::size_t numRows, std::mt19937_64& rng)
+{
+    std::uniform_int_distribution<std::uint32_t> id(10000, 99999);
+    std::uniform_int_distribution<std::size_t>   row(0, numRows - 1);
+    std::bernoulli_distribution                  repeat(0.5);
+    std::vector<std::uint32_t> left(numRows);
+    for (std::uint32_t& value : left)
+        value = id(rng);
+
+    std::string lists;
+    lists.reserve(numRows * 14);
+    for (std::size_t i = 0; i < numRows; ++i) {
+        lists += std::to_string(left[i]);
+        lists += "   ";
+        lists += std::to_string(repeat(rng) ? left[row(rng)] : id(rng));
+        lists += '\n';
+    }
+    return lists;
+}
+
+std::uint64_t checksum(const Lists& lists)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < lists.first.size(); ++i)
+        sum = sum * 31 + lists.first[i] * 7 + lists.second[i];
+    return sum;
+}
+
+Lists parseFromChars(std::string_view input)
+{
+    Lists lists;
+    auto& [lhs, rhs] = lists;
+    const char *cursor = input.data(), *const end = cursor + input.size();
+    while (cursor != end) {
+        const auto [ptr1, errc1] = std::from_chars(cursor, end,
+                                                   lhs.emplace_back());
+        assert(errc1 == std::errc());
+        for (cursor = ptr1; (cursor != end) && isspace(*cursor); ++cursor)
+            continue;
+        const auto [ptr2, errc2] = std::from_chars(cursor, end,
+                                                   rhs.emplace_back());
+        assert(errc2 == std::errc());
+        for (cursor = ptr2; (cursor != end) && isspace(*cursor); ++cursor)
+            continue;
+    }
+    return lists;
+}
+
+Lists parseScanner(std::string_view input)
+{
+    Lists lists;
+    auto& [lhs, rhs] = lists;
+    lhs.reserve(input.size() / 8);
+    rhs.reserve(input.size() / 8);
+    for (aoc::Scanner scanner(input); !scanner.atEnd(); ) {
+        [[maybe_unused]] bool parsed = scanner.readInt(lhs.emplace_back());
+        while (scanner.consume(' '))
+            continue;
+        parsed = parsed && scanner.readInt(rhs.emplace_back());
+        assert(parsed);
+        scanner.consume('\n');
+    }
+    return lists;
+}
+
+std::uint64_t distance(const Lists& lists)
+{
+    const auto& [lhs, rhs] = lists;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+        total += std::max(lhs[i], rhs[i]) - std::min(lhs[i], rhs[i]);
+    return total;
+}
+
+std::uint64_t distanceStdSort(std::string_view, Lists& lists)
+{
+    std::sort(lists.first.begin(),  lists.first.end());
+    std::sort(lists.second.begin(), lists.second.end());
+    return distance(lists);
+}
+
+std::uint64_t distanceRadixSort(std::string_view, Lists& lists)
+{
+    aoc::radixSort(std::span(lists.first));
+    aoc::radixSort(std::span(lists.second));
+    return distance(lists);
+}
+
+std::uint64_t similarityHashMap(std::string_view, Lists& lists)
+{
+    std::unordered_map<std::uint32_t, std::uint32_t> rhsCounts;
+    for (const auto num : lists.second)
+        ++rhsCounts[num];
+    std::uint64_t total = 0;
+    for (const auto num : lists.first)
+        total += std::uint64_t(num) * rhsCounts[num];
+    return total;
+}
+
+std::uint64_t similarityCounts(std::string_view, Lists& lists)
+{
+    std::vector<std::uint32_t> rhsCounts(std::ranges::max(lists.second) + 1);
+    for (const auto num : lists.second)
+        ++rhsCounts[num];
+    std::uint64_t total = 0;
+    for (const auto num : lists.first)
+        if (num < rhsCounts.size())
+            total += std::uint64_t(num) * rhsCounts[num];
+    return total;
+}
+
+std::uint64_t similarityMergeJoin(std::string_view, Lists& lists)
+{
+    auto& [lhs, rhs] = lists;
+    aoc::radixSort(std::span(lhs));
+    aoc::radixSort(std::span(rhs));
+    std::uint64_t total = 0;
+    auto right = rhs.begin();
+    for (auto left = lhs.begin(); left != lhs.end(); ) {
+        right = std::lower_bound(right, rhs.end(), *left);
+        const auto rightEnd = std::upper_bound(right, rhs.end(), *left);
+        const auto leftEnd  = std::upper_bound(left, lhs.end(), *left);
+        total += std::uint64_t(*left) * (leftEnd - left) * (rightEnd - right);
+        left  = leftEnd;
+        right = rightEnd;
+    }
+    return total;
+}
+
+// Kernels of the parsing stage ignore their lists and return the checksum of
+// what they parsed; the others get a fresh copy of the parsed lists per run.
+using Kernel = std::uint64_t (*)(std::string_view, Lists&);
+
+struct Stage {
+    std::string_view                                 d_name;
+    std::vector<std::pair<std::string_view, Kernel>> d_kernels;
+};
+
+// Run 'kernel' on 'input' and a copy of 'lists' 'numRuns' times and print
+// its fastest run.  Return its checksum.
+std::uint64_t time(std::string_view stage,
+                   std::string_view name,
+                   Kernel           kernel,
+                   std::string_view input,
+                   const Lists&     lists,
+                   int              numRuns)
+{
+    std::int64_t  minNs = 0;
+    std::uint64_t sum   = 0;
+    for (int run = 0; run < numRuns; ++run) {
+        Lists      copy  = lists;
+        const auto start = Clock::now();
+        sum = kernel(input, copy);
+        const std::int64_t ns =
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 Clock::now() - start).count();
+        minNs = run ? std::min(minNs, ns) : ns;
+    }
+    std::cout << stage              << '\t'
+              << lists.first.size() << '\t'
+              << input.size()       << '\t'
+              << name               << '\t'
+              << minNs              << '\t'
+              << (minNs ? input.size() * 1e3 / minNs : 0.0) << '\t'
+              << sum                << std::endl;
+    return sum;
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t numRows = 1 << 24;
+    int         numRuns = 1;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-n") && (i + 1 < argc)) {
+            numRows = std::max(1LL, std::atoll(argv[++i]));
+        }
+        else if ((arg == "-r") && (i + 1 < argc)) {
+            numRuns = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            std::cerr << "usage: " << argv[0] << " [-n ROWS] [-r RUNS]"
+                      << std::endl;
+            return 2;
+        }
+    }
+
+    std::mt19937_64   rng(2024);
+    const std::string input = makeLists(numRows, rng);
+    const Lists       lists = parseScanner(input);
+
+    const Stage stages[] = {
+        { "parse", {
+            { "from_chars", [](std::string_view input, Lists&) {
+                                return checksum(parseFromChars(input)); } },
+            { "scanner",    [](std::string_view input, Lists&) {
+                                return checksum(parseScanner(input)); } } } },
+        { "distance", {
+            { "std_sort",   distanceStdSort   },
+            { "radix_sort", distanceRadixSort } } },
+        { "similarity", {
+            { "hash_map",   similarityHashMap   },
+            { "counts",     similarityCounts    },
+            { "merge_join", similarityMergeJoin } } },
+    };
+    std::cout << "stage\trows\tbytes\tkernel\tmin_ns\tmb_per_s\tchecksum"
+              << std::endl;
+    int status = 0;
+    for (const Stage& stage : stages) {
+        std::uint64_t expected = 0;
+        for (const auto& [name, kernel] : stage.d_kernels) {
+            const std::uint64_t sum = time(stage.d_name, name, kernel,
+                                           input, lists, numRuns);
+            if (&name == &stage.d_kernels.front().first) {
+                expected = sum;
+            }
+            else if (sum != expected) {
+                std::cerr << stage.d_name << ": checksum mismatch for "
+                          << name << std::endl;
+                status = 1;
+            }
+        }
+    }
+    return status;
+}